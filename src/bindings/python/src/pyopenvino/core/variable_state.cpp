@@ -36,4 +36,27 @@ void regclass_VariableState(py::module m) {
                              R"(
         Gets/sets variable state.
     )");
+
+    variable_st.def("detach_state",
+                    &ov::VariableState::detach_state,
+                    R"(
+        Detaches the tensor holding the current state from the infer request without copying.
+        The infer request can't be inferred until a state is attached.
+
+        :return: A tensor representing a state.
+        :rtype: openvino.runtime.Tensor
+    )");
+
+    variable_st.def("attach_state",
+                    &ov::VariableState::attach_state,
+                    py::arg("state"),
+                    R"(
+        Attaches the tensor as the state for the next inference without copying its data.
+        The infer request owns the tensor memory until the request is destroyed,
+        so the tensor must not be accessed after it is attached: keep the tensor
+        returned by detach_state instead.
+
+        :param state: The tensor holding the state, e.g. the one returned by detach_state.
+        :type state: openvino.runtime.Tensor
+    )");
 }
@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface HorizonMax
+ * @brief Generated by Generator after the vector tile of a row pass, reduces the lanes of the RowMax accumulator
+ * and broadcasts the result to all of them
+ * @ingroup snippets
+ */
+class HorizonMax : public ngraph::op::Op {
+public:
+    OPENVINO_OP("HorizonMax", "SnippetsOpset");
+
+    HorizonMax() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& inputs) const override {
+        return std::make_shared<HorizonMax>();
+    }
+};
+
+/**
+ * @interface HorizonSum
+ * @brief Generated by Generator after the vector tile of a row pass, reduces the lanes of the RowSum accumulator
+ * and broadcasts the result to all of them
+ * @ingroup snippets
+ */
+class HorizonSum : public ngraph::op::Op {
+public:
+    OPENVINO_OP("HorizonSum", "SnippetsOpset");
+
+    HorizonSum() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& inputs) const override {
+        return std::make_shared<HorizonSum>();
+    }
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
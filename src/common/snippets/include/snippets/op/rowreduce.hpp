@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface RowReduce
+ * @brief Generated by RowReductionDecomposition and accumulates the input values over the least varying dimension.
+ * The output register keeps a vector of partial results for the whole row, which is reduced to a scalar
+ * (and broadcasted to all lanes) by the corresponding horizontal reduction after the row is processed
+ * @ingroup snippets
+ */
+class RowReduce : public ngraph::op::Op {
+public:
+    OPENVINO_OP("RowReduce", "SnippetsOpset");
+
+    RowReduce(const Output<Node>& x);
+    RowReduce() = default;
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+    void validate_and_infer_types() override;
+
+    /**
+     * @brief The value the accumulator is initialized with before the row is processed
+     */
+    virtual float get_identity_value() const = 0;
+};
+
+/**
+ * @interface RowMax
+ * @brief Maximum over the least varying dimension
+ * @ingroup snippets
+ */
+class RowMax : public RowReduce {
+public:
+    OPENVINO_OP("RowMax", "SnippetsOpset", ngraph::snippets::op::RowReduce);
+
+    RowMax(const Output<Node>& x);
+    RowMax() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+    float get_identity_value() const override;
+};
+
+/**
+ * @interface RowSum
+ * @brief Sum over the least varying dimension
+ * @ingroup snippets
+ */
+class RowSum : public RowReduce {
+public:
+    OPENVINO_OP("RowSum", "SnippetsOpset", ngraph::snippets::op::RowReduce);
+
+    RowSum(const Output<Node>& x);
+    RowSum() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+    float get_identity_value() const override;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
@@ -106,6 +106,9 @@ public:
 
     void serialize() const;
 
+    // returns true if the body contains reductions over the least varying dimension (see pass::IsRowReduction)
+    bool has_row_reductions() const;
+
     static auto wrap_node_as_subgraph(const std::shared_ptr<ngraph::Node>& node) -> std::shared_ptr<Subgraph>;
 
 private:
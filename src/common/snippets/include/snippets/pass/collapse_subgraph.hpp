@@ -22,6 +22,11 @@ SnippetsNodeType GetSnippetsNodeType(const std::shared_ptr<const Node>&);
 void SetTopologicalOrder(const std::shared_ptr<Node>&, int64_t);
 int64_t GetTopologicalOrder(const std::shared_ptr<const Node>&);
 bool AppropriateForSubgraph(const std::shared_ptr<const Node>&);
+/*
+ Returns true for the reductions over the least varying dimension that snippets decompose into row-wise accumulations:
+ Softmax, MVN and ReduceSum/ReduceMax/ReduceMean (keep_dims only) with static last dimension larger than 1
+ */
+bool IsRowReduction(const std::shared_ptr<const Node>&);
 
 /**
  * @interface EnumerateNodes
@@ -39,7 +44,10 @@ public:
  * @interface TokenizeSnippets
  * @brief Splits model to subgraphs if possible using rules above
  * This pass tokenizes topology graph into subgraphs.
- * Those subgraphs consists of unary or binary layout-oblivious (LO) opetations found in subset 1.
+ * Those subgraphs consists of unary or binary layout-oblivious (LO) opetations found in subset 1
+ * and of the reductions over the least varying dimension (see IsRowReduction).
+ * The operations are tokenized only if all their tensors are f32, except for Convert operations between f32 and bf16/i8/u8.
+ * The tensors may have dynamic shapes of static ranks, except for the row reductions that require static shapes.
  * Non-layout-oblivious (NLO) operations operations (called also support in this context) are ignored and become a fullstop in tokenization routine
  * 1. if a considered LO operation doesn't have any unput subgraphs
  *    -> a new single-op subgraph is introduced
@@ -54,6 +62,8 @@ public:
  * New subgraph is introduced, if there is a loop introduced
  * New subgraph is introduced, if number of inputs and outputs exceeds 7 due to scheduling limitation
  * New subgraph is introduced, if multiple outputs of merged nodes are not broadcastable to each other (equality of all outputs is too much on the other hand)
+ * New subgraph is introduced, if a merged reduction runs over a row, which length differs from the rest of the subgraph,
+ * or if there are too many reductions to keep their accumulators in registers
  * Scalar constants are placed as is into subgraph due to optimization purpose
  * @ingroup snippets
  */
@@ -0,0 +1,28 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+#include <ngraph/pattern/matcher.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface RowReductionDecomposition
+ * @brief Decomposes the reductions over the least varying dimension (see IsRowReduction) into RowMax/RowSum
+ * accumulations and elementwise operations, e.g. Softmax(x) = exp(x - RowMax(x)) * (1 / RowSum(exp(x - RowMax(x)))).
+ * The pass is used to convert model to a canonical form for code generation
+ * @ingroup snippets
+ */
+class RowReductionDecomposition: public ngraph::pass::MatcherPass {
+public:
+    RowReductionDecomposition();
+};
+
+} // namespace pass
+} // namespace snippets
+} // namespace ngraph
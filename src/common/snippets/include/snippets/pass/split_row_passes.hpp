@@ -0,0 +1,41 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/pass.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace pass {
+
+/*
+ Row stage of an operation in the model with row reductions. Odd stage 2p+1 is the loop over the row of the row pass p,
+ even stage 2p is executed once per row right before the row pass p (so stage 0 is the row prologue).
+ GetRowStage(...) returns -1 if the stage isn't set
+ */
+void SetRowStage(const std::shared_ptr<Node>&, int64_t);
+int64_t GetRowStage(const std::shared_ptr<const Node>&);
+
+/**
+ * @interface SplitRowPasses
+ * @brief Splits the model with RowReduce operations into the sequential passes over the row.
+ * A value that depends on a RowReduce output is available only after the whole row is processed, so its per-element
+ * consumers are moved to the next row pass, and the per-element operations they depend on are recomputed (cloned) there.
+ * The values uniform along the row (reduction results and operations on them) are computed once per row between the passes.
+ * The stages are stored in the runtime info and the execution order is fixed by control dependencies.
+ * Must be called after the model is converted to the snippets dialect and before the register assignment.
+ * @ingroup snippets
+ */
+class SplitRowPasses : public ngraph::pass::FunctionPass {
+public:
+    SplitRowPasses() {
+        set_property(ngraph::pass::PassProperty::REQUIRE_STATIC_SHAPE, true);
+    }
+    bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
+};
+
+}  // namespace pass
+}  // namespace snippets
+}  // namespace ngraph
@@ -21,6 +21,10 @@ NGRAPH_OP(ScalarStore, ngraph::snippets::op)
 NGRAPH_OP(VectorStore, ngraph::snippets::op)
 
 NGRAPH_OP(BroadcastMove, ngraph::snippets::op)
+NGRAPH_OP(RowMax, ngraph::snippets::op)
+NGRAPH_OP(RowSum, ngraph::snippets::op)
+NGRAPH_OP(HorizonMax, ngraph::snippets::op)
+NGRAPH_OP(HorizonSum, ngraph::snippets::op)
 NGRAPH_OP(Scalar, ngraph::snippets::op)
 NGRAPH_OP(Nop, ngraph::snippets::op)
 
@@ -40,6 +44,7 @@ NGRAPH_OP(Asin, ngraph::op::v0)
 NGRAPH_OP(Atan, ngraph::op::v0)
 NGRAPH_OP(Ceiling, ngraph::op::v0)
 NGRAPH_OP(Clamp, ngraph::op::v0)
+NGRAPH_OP(Convert, ngraph::op::v0)
 NGRAPH_OP(Cos, ngraph::op::v0)
 NGRAPH_OP(Cosh, ngraph::op::v0)
 NGRAPH_OP(Elu, ngraph::op::v0)
@@ -6,11 +6,36 @@
 #include "snippets/pass/assign_registers.hpp"
 #include "snippets/pass/vector_to_scalar.hpp"
 #include "snippets/pass/insert_load_store.hpp"
+#include "snippets/pass/split_row_passes.hpp"
 #include "snippets/op/tile.hpp"
 #include "snippets/op/kernel.hpp"
+#include "snippets/op/horizonreduce.hpp"
+#include "snippets/op/broadcastmove.hpp"
+#include "snippets/op/rowreduce.hpp"
+#include "snippets/op/scalar.hpp"
 #include <snippets/itt.hpp>
 
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include <map>
+#include <set>
+
+namespace {
+using EmitterRegions = std::map<int64_t, std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>>>;
+
+// Returns the indexes of the parameters loaded with the post increment in the row stage
+std::set<size_t> get_loaded_parameters(const std::shared_ptr<ov::Model>& m, const ngraph::NodeVector& ops) {
+    std::set<size_t> indexes;
+    for (const auto& n : ops) {
+        if (ov::is_type<ngraph::snippets::op::Load>(n) && n->get_input_shape(0).back() != 1) {
+            if (const auto param = ov::as_type_ptr<ngraph::opset1::Parameter>(n->get_input_node_shared_ptr(0)))
+                indexes.insert(static_cast<size_t>(m->get_parameter_index(param)));
+        }
+    }
+    return indexes;
+}
+} // namespace
 
 auto ngraph::snippets::getRegisters(std::shared_ptr<ngraph::Node>& n) -> ngraph::snippets::RegInfo {
     OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::getRegisters")
@@ -53,9 +78,16 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     OV_ITT_TASK_CHAIN(GENERATE, ngraph::pass::itt::domains::SnippetsTransform, "Snippets::Generator", "::VectorTile")
     // vector tile
     std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>> lowered;
+    // the emitters are also grouped by the row stages if the model is split into the row passes (see SplitRowPasses)
+    EmitterRegions vector_stages;
+    std::map<int64_t, NodeVector> stage_ops;
     for (auto n : m->get_ordered_ops()) {
         lowered.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
+        const auto stage = ngraph::snippets::pass::GetRowStage(n);
+        vector_stages[stage].push_back(lowered.back());
+        stage_ops[stage].push_back(n);
     }
+    const bool has_row_passes = vector_stages.rbegin()->first >= 0;
     OV_ITT_TASK_NEXT(GENERATE, "::ScalarTile")
 
     // scalar tile
@@ -66,21 +98,86 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     mng.run_passes(m_scalar);
     OV_ITT_TASK_NEXT(GENERATE, "::ScalarTile_get")
     std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> scalar_lowered;
+    EmitterRegions scalar_stages;
     for (auto n : m_scalar->get_ordered_ops()) {
         scalar_lowered.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
+        scalar_stages[ngraph::snippets::pass::GetRowStage(n)].push_back(scalar_lowered.back());
     }
     OV_ITT_TASK_NEXT(GENERATE, "::Tiles1D")
 
     // wrapping into tiles1D
     std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> tiles1D;
-    auto tile = std::make_shared<ngraph::snippets::op::Tile>(lowered);
-    tile->compile_params = compile_params;
-    tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
-                                   std::make_pair(std::vector<size_t>({target->get_lanes(), 0, nptrs, 1}), std::vector<size_t>{})));
-    tile = std::make_shared<ngraph::snippets::op::Tile>(scalar_lowered);
-    tile->compile_params = compile_params;
-    tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
-                    std::make_pair(std::vector<size_t>{{1, target->get_lanes(), nptrs, 1}}, std::vector<size_t>{})));
+    std::shared_ptr<ngraph::snippets::op::Tile> tile;
+    if (!has_row_passes) {
+        tile = std::make_shared<ngraph::snippets::op::Tile>(lowered);
+        tile->compile_params = compile_params;
+        tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
+                                       std::make_pair(std::vector<size_t>({target->get_lanes(), 0, nptrs, 1}), std::vector<size_t>{})));
+        tile = std::make_shared<ngraph::snippets::op::Tile>(scalar_lowered);
+        tile->compile_params = compile_params;
+        tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
+                        std::make_pair(std::vector<size_t>{{1, target->get_lanes(), nptrs, 1}}, std::vector<size_t>{})));
+    } else {
+        // The row passes are executed one after another for every row:
+        //  * the even stages (values uniform along the row) are emitted once per row right into the outer tile;
+        //  * the odd stages are the passes over the row, the reduction accumulators are initialized before the pass,
+        //    the vector lanes of the accumulators are reduced horizontally before the scalar tail is processed,
+        //    the tail updates only the lane 0, so it's broadcast to the other lanes after the tail,
+        //    and the pointers of the inputs that are read again in the next passes are rewound after the tail.
+        for (const auto& stage : vector_stages) {
+            if (stage.first < 0)
+                continue;
+            if (stage.first % 2 == 0) {
+                tiles1D.insert(tiles1D.end(), stage.second.begin(), stage.second.end());
+                continue;
+            }
+            std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> inits, horizons, broadcasts;
+            for (auto n : stage_ops[stage.first]) {
+                if (const auto reduce = ov::as_type_ptr<ngraph::snippets::op::RowReduce>(n)) {
+                    const auto acc = getRegisters(n).second;
+                    std::shared_ptr<Node> identity = std::make_shared<ngraph::snippets::op::Scalar>(element::f32, Shape{1},
+                                                                                                  reduce->get_identity_value());
+                    inits.push_back(std::make_pair(target->get(identity->get_type_info())(identity), std::make_pair(std::vector<size_t>{}, acc)));
+                    std::shared_ptr<Node> horizon;
+                    if (ov::is_type<ngraph::snippets::op::RowMax>(reduce))
+                        horizon = std::make_shared<ngraph::snippets::op::HorizonMax>();
+                    else
+                        horizon = std::make_shared<ngraph::snippets::op::HorizonSum>();
+                    horizons.push_back(std::make_pair(target->get(horizon->get_type_info())(horizon), std::make_pair(acc, acc)));
+                    // the scalar tail loads the values with the upper lanes zeroed, so the lanes other than 0 are stale after it
+                    const auto lane = std::make_shared<opset1::Parameter>(element::f32, Shape{1});
+                    std::shared_ptr<Node> broadcast = std::make_shared<ngraph::snippets::op::BroadcastMove>(lane, Shape{target->get_lanes()});
+                    broadcasts.push_back(std::make_pair(target->get(broadcast->get_type_info())(broadcast), std::make_pair(acc, acc)));
+                }
+            }
+            tiles1D.insert(tiles1D.end(), inits.begin(), inits.end());
+            lowered.insert(lowered.end(), inits.begin(), inits.end());
+
+            tile = std::make_shared<ngraph::snippets::op::Tile>(stage.second);
+            tile->compile_params = compile_params;
+            tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
+                                             std::make_pair(std::vector<size_t>({target->get_lanes(), 0, nptrs, 1}), std::vector<size_t>{})));
+
+            tiles1D.insert(tiles1D.end(), horizons.begin(), horizons.end());
+
+            std::vector<size_t> scalar_tile_args{1, target->get_lanes(), nptrs, 1};
+            std::set<size_t> read_later;
+            for (auto next = stage_ops.upper_bound(stage.first); next != stage_ops.end(); next++) {
+                const auto loaded = get_loaded_parameters(m, next->second);
+                read_later.insert(loaded.begin(), loaded.end());
+            }
+            for (const auto idx : get_loaded_parameters(m, stage_ops[stage.first])) {
+                if (read_later.count(idx))
+                    scalar_tile_args.push_back(idx);
+            }
+            tile = std::make_shared<ngraph::snippets::op::Tile>(scalar_stages[stage.first]);
+            tile->compile_params = compile_params;
+            tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
+                                             std::make_pair(scalar_tile_args, std::vector<size_t>{})));
+
+            tiles1D.insert(tiles1D.end(), broadcasts.begin(), broadcasts.end());
+        }
+    }
 
     OV_ITT_TASK_NEXT(GENERATE, "::Tiles2D")
     // wrapping into tiles2D
@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+
+#include "snippets/op/rowreduce.hpp"
+
+#include <limits>
+
+using namespace std;
+using namespace ngraph;
+
+snippets::op::RowReduce::RowReduce(const Output<Node>& x) : Op({x}) {
+}
+
+bool snippets::op::RowReduce::visit_attributes(AttributeVisitor& visitor) {
+    return true;
+}
+
+void snippets::op::RowReduce::validate_and_infer_types() {
+    auto shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, shape.rank().is_static() && shape.rank().get_length() > 0,
+                          "RowReduce doesn't support scalar or dynamic rank input");
+    shape[shape.rank().get_length() - 1] = 1;
+    set_output_type(0, get_input_element_type(0), shape);
+}
+
+snippets::op::RowMax::RowMax(const Output<Node>& x) : RowReduce(x) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<Node> snippets::op::RowMax::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(RowMax);
+    check_new_args_count(this, new_args);
+    return std::make_shared<RowMax>(new_args.at(0));
+}
+
+float snippets::op::RowMax::get_identity_value() const {
+    return std::numeric_limits<float>::lowest();
+}
+
+snippets::op::RowSum::RowSum(const Output<Node>& x) : RowReduce(x) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<Node> snippets::op::RowSum::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(RowSum);
+    check_new_args_count(this, new_args);
+    return std::make_shared<RowSum>(new_args.at(0));
+}
+
+float snippets::op::RowSum::get_identity_value() const {
+    return 0.f;
+}
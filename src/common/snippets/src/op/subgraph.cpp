@@ -13,6 +13,10 @@
 #include "snippets/pass/convert_constants_to_scalars.hpp"
 #include "snippets/pass/convert_power_to_powerstatic.hpp"
 #include "snippets/pass/vector_to_scalar.hpp"
+#include "snippets/pass/collapse_subgraph.hpp"
+#include "snippets/pass/row_reduction_decomposition.hpp"
+#include "snippets/pass/split_row_passes.hpp"
+#include "snippets/op/rowreduce.hpp"
 
 #include <ngraph/pass/manager.hpp>
 #include <openvino/pass/serialize.hpp>
@@ -69,6 +73,13 @@ bool snippets::op::Subgraph::visit_attributes(AttributeVisitor& visitor) {
     return true;
 }
 
+bool snippets::op::Subgraph::has_row_reductions() const {
+    const auto& ops = m_body->get_ops();
+    return std::any_of(ops.begin(), ops.end(), [](const std::shared_ptr<Node>& n) {
+        return ov::is_type<op::RowReduce>(n) || pass::IsRowReduction(n);
+    });
+}
+
 auto snippets::op::Subgraph::wrap_node_as_subgraph(const std::shared_ptr<ov::Node>& node) -> std::shared_ptr<op::Subgraph> {
     INTERNAL_OP_SCOPE(Subgraph);
     OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::wrap_node_as_subgraph")
@@ -175,9 +186,24 @@ Shape snippets::op::Subgraph::canonicalize(const BlockedShapeVector& outputShape
         NODE_VALIDATION_CHECK(this,
                               PartialShape::broadcast_merge_into(tmpPShape, inShape, ::ngraph::op::AutoBroadcastType::NUMPY),
                               "Failed to create broadcastable shapes in snippets canonicalization");
-        const auto paramShape = m_body->get_parameters()[i]->get_shape();
-        if (paramShape.size() != inShape.size() || !equal(paramShape.begin(), paramShape.end(), inShape.begin()))
-                m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(inType, inShape));
+        const auto param = m_body->get_parameters()[i];
+        // the body may have dynamic shapes, the actual ones are passed for the canonicalization
+        const auto paramShape = param->get_partial_shape();
+        const auto paramType = param->get_element_type();
+        if (paramShape != PartialShape(inShape) || paramType != inType) {
+            auto newParam = std::make_shared<opset1::Parameter>(inType, inShape);
+            // The body keeps computing in its own precision, the input is converted right after it's loaded
+            if (paramType != inType)
+                replace_node(param, std::make_shared<opset1::Convert>(newParam, paramType));
+            m_body->replace_parameter(i, newParam);
+        }
+    }
+    // The outputs are converted to the passed precisions right before they are stored
+    for (size_t i = 0; i < outputShapes.size(); i++) {
+        const auto outType = std::get<2>(outputShapes[i]);
+        const auto& result = m_body->get_results()[i];
+        if (result->get_input_element_type(0) != outType)
+            result->input(0).replace_source_output(std::make_shared<opset1::Convert>(result->input_value(0), outType));
     }
 
     m_body->validate_nodes_and_infer_types();
@@ -213,6 +239,14 @@ Shape snippets::op::Subgraph::canonicalize(const BlockedShapeVector& outputShape
                                                                ::ngraph::op::AutoBroadcastType::NUMPY);
         NODE_VALIDATION_CHECK(this, compatibleWithOtherOutputs, "Snippets output shapes must be numpy broadcastable");
     }
+    // The reduced outputs are smaller than the rows the reductions run over, so the inputs also define the domain
+    if (has_row_reductions()) {
+        for (const auto& param : m_body->get_parameters()) {
+            NODE_VALIDATION_CHECK(this, PartialShape::broadcast_merge_into(outPShape, param->get_shape(),
+                                                                          ::ngraph::op::AutoBroadcastType::NUMPY),
+                                  "Snippets input shapes must be numpy broadcastable to the outputs for row reductions");
+        }
+    }
     exec_domain = outPShape.get_shape();
     return exec_domain;
 }
@@ -224,6 +258,7 @@ void snippets::op::Subgraph::convert_to_snippet_dialect() {
         return n->get_input_shape(0).back() != 1;
     };
     ngraph::pass::Manager manager;
+    manager.register_pass<snippets::pass::RowReductionDecomposition>();
     manager.register_pass<snippets::pass::ConvertConstantsToScalars>();
     manager.register_pass<snippets::pass::ConvertPowerToPowerStatic>();
     manager.register_pass<snippets::pass::InsertLoad>();
@@ -267,6 +302,7 @@ snippets::Schedule snippets::op::Subgraph::generate(ngraph::pass::Manager& opt,
     NGRAPH_CHECK(m_generator != nullptr, "generate is called while generator is not set");
     convert_to_snippet_dialect();
     opt.run_passes(m_body);
+    snippets::pass::SplitRowPasses().run_on_model(m_body);
 
     // generation flow
     snippets::pass::AssignRegisters().run_on_model(m_body);
@@ -104,15 +104,22 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
         return i;
     };
 
+    // The accumulators of the row reductions are updated on every iteration over the row and are read after it,
+    // so the registers are reserved for them from the top of the bank and don't take part in the allocation below
+    std::map<Reg, Reg> register_map;
+    Reg reserved = 16;
     for (size_t i = 0; i < stmts.size(); i++) {
-        live_intervals.insert(std::make_pair(i, find_last_use(i)));
+        if (ov::is_type<snippets::op::RowReduce>(stmts[i])) {
+            register_map[i] = --reserved;
+        } else {
+            live_intervals.insert(std::make_pair(i, find_last_use(i)));
+        }
     }
 
     // http://web.cs.ucla.edu/~palsberg/course/cs132/linearscan.pdf
     std::multiset<std::pair<int, int>, by_ending> active;
-    std::map<Reg, Reg> register_map;
     std::stack<Reg> bank;
-    for (int i = 0; i < 16; i++) bank.push(16-1-i);
+    for (Reg i = 0; i < reserved; i++) bank.push(reserved-1-i);
 
     for (auto interval : live_intervals) {
         // check expired
@@ -125,7 +132,7 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
             bank.push(register_map[x.first]);
         }
         // allocate
-        if (active.size() == 16) {
+        if (bank.empty()) {
             throw ngraph_error("caanot allocate registers for a snippet ");
         } else {
             register_map[interval.first] = bank.top();
@@ -31,6 +31,17 @@ namespace {
 
 auto outputs_are_not_broadcastable(const std::shared_ptr<const Node>& node) -> bool {
     auto outputs = node->outputs();
+    // The dynamic outputs are checked to be broadcastable to each other, the actual shapes are checked on canonicalization
+    const bool is_dynamic = std::any_of(outputs.begin(), outputs.end(), [](const Output<const Node>& output) {
+        return output.get_partial_shape().is_dynamic();
+    });
+    if (is_dynamic) {
+        PartialShape merged_shape = outputs.begin()->get_partial_shape();
+        return std::any_of(outputs.begin(), outputs.end(), [&merged_shape](const Output<const Node>& output) {
+            return output.get_partial_shape().rank() != merged_shape.rank() ||
+                   !PartialShape::broadcast_merge_into(merged_shape, output.get_partial_shape(), ::ngraph::op::AutoBroadcastType::NUMPY);
+        });
+    }
     auto find_smallest_output_shape = [](const std::vector<Output<const Node>>& outputs) -> Shape {
         return std::accumulate(std::begin(outputs), std::end(outputs), ngraph::Shape(outputs.begin()->get_shape()),
             [](Shape& other_shape, const Output<const Node>& output){
@@ -84,6 +95,7 @@ auto is_layout_oblivious(const std::shared_ptr<const Node> &n) -> bool {
     auto is_layout_oblivious_unary = [](const std::shared_ptr<const Node> &n) -> bool {
         return ov::is_type<opset1::Abs>(n)
             || ov::is_type<opset1::Clamp>(n)
+            || ov::is_type<opset1::Convert>(n)
             || ov::is_type<opset1::Elu>(n)
             || ov::is_type<opset1::Erf>(n)
             || ov::is_type<opset1::Exp>(n)
@@ -101,11 +113,24 @@ auto is_layout_oblivious(const std::shared_ptr<const Node> &n) -> bool {
 }
 
 auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
-    auto supported = [](descriptor::Tensor& t) -> bool {
-        return t.get_element_type() == ngraph::element::f32 &&
-               t.get_partial_shape().is_static();
+    // The kernels compute in f32, so the low precisions are supported only by the conversions to and from f32:
+    // they are performed in registers right after the data is loaded or before it's stored
+    const auto convert = ov::as_type_ptr<const opset1::Convert>(n);
+    auto supported_type = [&convert](const element::Type& type) -> bool {
+        return type == element::f32 ||
+               (convert && (type == element::bf16 || type == element::i8 || type == element::u8));
+    };
+    if (convert && convert->get_input_element_type(0) != element::f32 && convert->get_destination_type() != element::f32)
+        return false;
+    // The row reductions are decomposed using the row length, so they require static shapes,
+    // the other operations are scheduled at runtime and require only static ranks
+    const bool is_row_reduction = IsRowReduction(n);
+    auto supported = [&supported_type, is_row_reduction](descriptor::Tensor& t) -> bool {
+        return supported_type(t.get_element_type()) &&
+               (is_row_reduction ? t.get_partial_shape().is_static() : t.get_partial_shape().rank().is_static());
     };
-    const auto & inputs = n->inputs();
+    // the reduction axes are the internal constants of the body, so only the data input is checked
+    const auto & inputs = is_row_reduction ? std::vector<Input<const Node>>{n->input(0)} : n->inputs();
     const auto & outputs = n->outputs();
     // todo: Is this check necessary? Remove if not
     for (const auto& out : outputs) {
@@ -137,6 +162,47 @@ auto get_num_result_children(const std::shared_ptr<const Node> &node) -> size_t
     }
     return result;
 }
+// The accumulators of the row reductions are kept in the dedicated vector registers during the whole kernel
+constexpr size_t max_row_accumulators = 4;
+
+auto get_row_accumulators_count(const std::shared_ptr<const Node> &node) -> size_t {
+    if (const auto mvn = ov::as_type_ptr<const ngraph::op::v6::MVN>(node))
+        return mvn->get_normalize_variance() ? 2 : 1;
+    if (ov::is_type<opset1::Softmax>(node) || ov::is_type<ngraph::op::v8::Softmax>(node))
+        return 2;
+    return 1;
+}
+
+// All the row reductions of a subgraph are scheduled over the least varying dimension of the master shape,
+// so their inputs must span the whole row (e.g. ReduceSum(<N, C>) can't be merged with an output of <N, D> shape)
+auto row_reductions_can_be_scheduled(const std::shared_ptr<ov::Model> &body) -> bool {
+    const auto& ops = body->get_ops();
+    if (std::none_of(ops.begin(), ops.end(), [](const std::shared_ptr<Node>& op) { return IsRowReduction(op); }))
+        return true;
+    // the row length must be known, so the row reductions can't be merged with the dynamic operations
+    if (body->is_dynamic())
+        return false;
+    size_t row_length = 1;
+    auto update_row_length = [&row_length](const Shape& shape) {
+        if (!shape.empty() && shape.back() != 1)
+            row_length = shape.back();
+    };
+    for (const auto& parameter : body->get_parameters())
+        update_row_length(parameter->get_shape());
+    for (const auto& result : body->get_results())
+        update_row_length(result->get_input_shape(0));
+
+    size_t accumulators = 0;
+    for (const auto& op : ops) {
+        if (IsRowReduction(op)) {
+            if (op->get_input_shape(0).back() != row_length)
+                return false;
+            accumulators += get_row_accumulators_count(op);
+        }
+    }
+    return accumulators <= max_row_accumulators;
+}
+
 // Need to update tensor name manually, since MKLDNNGraph::Replicate() looks at input.get_tensor().get_name();
 // If subgraph->get_output_size() == 1, then the name will be restored correctly from the node name
 auto update_out_tensor_name(std::shared_ptr<ngraph::snippets::op::Subgraph> &subgraph) -> void {
@@ -162,7 +228,41 @@ auto update_out_tensor_name(std::shared_ptr<ngraph::snippets::op::Subgraph> &sub
 } // namespace
 
 bool AppropriateForSubgraph(const std::shared_ptr<const Node> &node) {
-    return is_layout_oblivious(node) && has_supported_in_out(node);
+    return (is_layout_oblivious(node) || IsRowReduction(node)) && has_supported_in_out(node);
+}
+
+bool IsRowReduction(const std::shared_ptr<const Node> &node) {
+    if (node->get_input_size() == 0)
+        return false;
+    const auto& in_shape = node->get_input_partial_shape(0);
+    if (in_shape.is_dynamic() || in_shape.rank().get_length() == 0)
+        return false;
+    const auto rank = in_shape.rank().get_length();
+    if (in_shape[rank - 1].get_length() == 1)
+        return false;
+
+    const auto is_last_axis = [rank](int64_t axis) {
+        return axis == rank - 1 || axis == -1;
+    };
+    const auto has_last_axis_input = [&](size_t i) {
+        const auto axes = ov::as_type_ptr<opset1::Constant>(node->get_input_node_shared_ptr(i));
+        if (!axes)
+            return false;
+        const auto values = axes->cast_vector<int64_t>();
+        return values.size() == 1 && is_last_axis(values[0]);
+    };
+
+    if (const auto softmax = ov::as_type_ptr<const opset1::Softmax>(node))
+        return is_last_axis(static_cast<int64_t>(softmax->get_axis()));
+    if (const auto softmax = ov::as_type_ptr<const ngraph::op::v8::Softmax>(node))
+        return is_last_axis(softmax->get_axis());
+    if (ov::is_type<ngraph::op::v6::MVN>(node))
+        return has_last_axis_input(1);
+    if (ov::is_type<opset1::ReduceSum>(node) || ov::is_type<opset1::ReduceMax>(node) || ov::is_type<opset1::ReduceMean>(node)) {
+        const auto reduce = ov::as_type_ptr<const ngraph::op::util::ArithmeticReductionKeepDims>(node);
+        return reduce->get_keep_dims() && has_last_axis_input(1);
+    }
+    return false;
 }
 
 void SetSnippetsNodeType(const std::shared_ptr<Node> &node, SnippetsNodeType nodeType) {
@@ -485,6 +585,8 @@ TokenizeSnippets::TokenizeSnippets() {
         for (size_t i = 0; i < body->get_parameters().size(); i++) {
             body->get_parameters()[i]->set_friendly_name(body_parameters[i]->get_friendly_name());
         }
+        if (!row_reductions_can_be_scheduled(body))
+            return abort_with_strategy("New subgraph is created since the row reductions can't be scheduled together.");
         auto subgraph = op::build_subgraph(node, external_inputs, body, newSubgraphName);
         auto act_body = subgraph->get_body();
         for (size_t i = 0; i < act_body->get_parameters().size(); i++) {
@@ -0,0 +1,107 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+#include "snippets/snippets_isa.hpp"
+#include "snippets/pass/row_reduction_decomposition.hpp"
+#include "snippets/pass/collapse_subgraph.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+
+#include <unordered_set>
+
+namespace {
+
+std::shared_ptr<ngraph::Node> make_scalar(float value) {
+    return ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {value});
+}
+
+// The division is replaced with a multiplication by the reciprocal, which is computed once per row
+std::shared_ptr<ngraph::Node> make_reciprocal(const ngraph::Output<ngraph::Node>& x) {
+    return std::make_shared<ngraph::opset1::Divide>(make_scalar(1.f), x);
+}
+
+std::shared_ptr<ngraph::Node> make_mean(const ngraph::Output<ngraph::Node>& x) {
+    const auto row_length = static_cast<float>(x.get_shape().back());
+    return std::make_shared<ngraph::opset1::Multiply>(std::make_shared<ngraph::snippets::op::RowSum>(x),
+                                                      make_scalar(1.f / row_length));
+}
+
+std::shared_ptr<ngraph::Node> decompose_softmax(const ngraph::Output<ngraph::Node>& x) {
+    const auto max = std::make_shared<ngraph::snippets::op::RowMax>(x);
+    const auto exp = std::make_shared<ngraph::opset1::Exp>(std::make_shared<ngraph::opset1::Subtract>(x, max));
+    const auto sum = std::make_shared<ngraph::snippets::op::RowSum>(exp);
+    return std::make_shared<ngraph::opset1::Multiply>(exp, make_reciprocal(sum));
+}
+
+std::shared_ptr<ngraph::Node> decompose_mvn(const std::shared_ptr<ngraph::op::v6::MVN>& mvn) {
+    const auto x = mvn->input_value(0);
+    const auto centered = std::make_shared<ngraph::opset1::Subtract>(x, make_mean(x));
+    if (!mvn->get_normalize_variance())
+        return centered;
+
+    const auto variance = make_mean(std::make_shared<ngraph::opset1::Multiply>(centered, centered));
+    const auto eps = make_scalar(mvn->get_eps());
+    std::shared_ptr<ngraph::Node> stddev;
+    if (mvn->get_eps_mode() == ngraph::op::MVNEpsMode::INSIDE_SQRT) {
+        stddev = std::make_shared<ngraph::opset1::Sqrt>(std::make_shared<ngraph::opset1::Add>(variance, eps));
+    } else {
+        stddev = std::make_shared<ngraph::opset1::Add>(std::make_shared<ngraph::opset1::Sqrt>(variance), eps);
+    }
+    return std::make_shared<ngraph::opset1::Multiply>(centered, make_reciprocal(stddev));
+}
+
+// Collects the nodes between the decomposition output and its input
+ngraph::NodeVector get_decomposition_nodes(const std::shared_ptr<ngraph::Node>& decomposed, const ngraph::Output<ngraph::Node>& x) {
+    ngraph::NodeVector nodes;
+    std::unordered_set<ngraph::Node*> visited{x.get_node()};
+    std::vector<std::shared_ptr<ngraph::Node>> stack{decomposed};
+    while (!stack.empty()) {
+        auto node = stack.back();
+        stack.pop_back();
+        if (!visited.insert(node.get()).second)
+            continue;
+        nodes.push_back(node);
+        for (const auto& input : node->input_values())
+            stack.push_back(input.get_node_shared_ptr());
+    }
+    return nodes;
+}
+
+} // namespace
+
+ngraph::snippets::pass::RowReductionDecomposition::RowReductionDecomposition() {
+    MATCHER_SCOPE(RowReductionDecomposition);
+    auto reduction = std::make_shared<pattern::op::Label>(pattern::any_input(),
+                                                    [](std::shared_ptr<Node> n) {
+                                                        return IsRowReduction(n);
+                                                    });
+    ngraph::graph_rewrite_callback callback = [this](ngraph::pattern::Matcher &m) {
+        OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::RowReductionDecomposition")
+        auto root = m.get_match_root();
+        const auto x = root->input_value(0);
+
+        std::shared_ptr<Node> decomposed;
+        if (ov::is_type<opset1::Softmax>(root) || ov::is_type<ngraph::op::v8::Softmax>(root)) {
+            decomposed = decompose_softmax(x);
+        } else if (auto mvn = ov::as_type_ptr<ngraph::op::v6::MVN>(root)) {
+            decomposed = decompose_mvn(mvn);
+        } else if (ov::is_type<opset1::ReduceMax>(root)) {
+            decomposed = std::make_shared<snippets::op::RowMax>(x);
+        } else if (ov::is_type<opset1::ReduceSum>(root)) {
+            decomposed = std::make_shared<snippets::op::RowSum>(x);
+        } else if (ov::is_type<opset1::ReduceMean>(root)) {
+            decomposed = make_mean(x);
+        } else {
+            return false;
+        }
+
+        decomposed->set_friendly_name(root->get_friendly_name());
+        ngraph::copy_runtime_info(root, get_decomposition_nodes(decomposed, x));
+        ngraph::replace_node(root, decomposed);
+        return true;
+    };
+    register_matcher(std::make_shared<ov::pass::pattern::Matcher>(reduction), callback);
+}
@@ -0,0 +1,171 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+#include "remarks.hpp"
+
+#include "snippets/pass/split_row_passes.hpp"
+#include "snippets/snippets_isa.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+
+#include <functional>
+#include <map>
+#include <unordered_map>
+
+namespace ngraph {
+namespace snippets {
+namespace pass {
+
+namespace {
+
+// Per-element values are computed in the loop of the row pass, uniform values are computed once per row
+// and are available after the row pass (pass -1 stands for the row prologue)
+struct RowPlacement {
+    bool per_element;
+    int64_t pass;
+};
+
+// Loads of the inputs broadcasted along the row read the same value on every iteration
+auto is_uniform_load(const std::shared_ptr<Node>& n) -> bool {
+    return (ov::is_type<op::Load>(n) || ov::is_type<op::BroadcastLoad>(n)) && n->get_input_shape(0).back() == 1;
+}
+
+// Stores of the reduced values write a single value per row
+auto is_per_element_store(const std::shared_ptr<Node>& n) -> bool {
+    return ov::is_type<op::Store>(n) && n->get_input_shape(0).back() != 1;
+}
+
+} // namespace
+
+void SetRowStage(const std::shared_ptr<Node>& node, int64_t stage) {
+    auto &rt = node->get_rt_info();
+    rt["RowStage"] = stage;
+}
+
+int64_t GetRowStage(const std::shared_ptr<const Node>& node) {
+    auto &rt = node->get_rt_info();
+    const auto rinfo = rt.find("RowStage");
+    if (rinfo == rt.end())
+        return -1;
+    return rinfo->second.as<int64_t>();
+}
+
+bool SplitRowPasses::run_on_model(const std::shared_ptr<ov::Model>& m) {
+    RUN_ON_FUNCTION_SCOPE(SplitRowPasses);
+    OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::SplitRowPasses")
+    const auto ops = m->get_ordered_ops();
+    if (std::none_of(ops.begin(), ops.end(), [](const std::shared_ptr<Node>& n) { return ov::is_type<op::RowReduce>(n); }))
+        return false;
+
+    std::unordered_map<const Node*, RowPlacement> placements;
+    std::map<std::pair<const Node*, int64_t>, std::shared_ptr<Node>> clones;
+    // returns the value computed in the given row pass, per-element values of the previous passes are recomputed
+    std::function<Output<Node>(const Output<Node>&, int64_t)> get_in_pass = [&](const Output<Node>& value, int64_t pass) {
+        const auto node = value.get_node_shared_ptr();
+        const auto placement = placements.find(node.get());
+        if (placement == placements.end() || !placement->second.per_element || placement->second.pass == pass)
+            return value;
+        auto& clone = clones[{node.get(), pass}];
+        if (!clone) {
+            OutputVector inputs;
+            for (const auto& input : node->input_values())
+                inputs.push_back(get_in_pass(input, pass));
+            clone = node->clone_with_new_inputs(inputs);
+            ngraph::copy_runtime_info(node, clone);
+            placements[clone.get()] = {true, pass};
+            SetRowStage(clone, 2 * pass + 1);
+        }
+        return clone->output(value.get_index());
+    };
+
+    for (const auto& op : ops) {
+        // Scalars are placed to the stages of their consumers below
+        if (ov::is_type<opset1::Parameter>(op) || ov::is_type<opset1::Result>(op) || ov::is_type<op::Scalar>(op))
+            continue;
+        if (is_uniform_load(op)) {
+            placements[op.get()] = {false, -1};
+            SetRowStage(op, 0);
+            continue;
+        }
+
+        bool per_element = ov::is_type<op::Load>(op) || ov::is_type<op::RowReduce>(op) || is_per_element_store(op);
+        int64_t per_element_pass = 0;
+        int64_t uniform_pass = -1;
+        for (const auto& input : op->input_values()) {
+            const auto placement = placements.find(input.get_node());
+            if (placement == placements.end())
+                continue;
+            if (placement->second.per_element) {
+                per_element = true;
+                per_element_pass = std::max(per_element_pass, placement->second.pass);
+            } else {
+                uniform_pass = std::max(uniform_pass, placement->second.pass);
+            }
+        }
+
+        if (!per_element) {
+            placements[op.get()] = {false, uniform_pass};
+            SetRowStage(op, 2 * uniform_pass + 2);
+            continue;
+        }
+
+        // a value uniform along the row can be used only in the passes after it's computed
+        const auto pass = std::max(per_element_pass, uniform_pass + 1);
+        for (size_t i = 0; i < op->get_input_size(); i++)
+            op->input(i).replace_source_output(get_in_pass(op->input_value(i), pass));
+        // the reduction result is uniform along the row and available only after the pass
+        placements[op.get()] = {!ov::is_type<op::RowReduce>(op), pass};
+        SetRowStage(op, 2 * pass + 1);
+    }
+
+    // Scalars are cloned to every stage they're used in to keep the register live ranges within the stage
+    std::map<std::pair<const Node*, int64_t>, std::shared_ptr<Node>> scalars;
+    std::map<int64_t, NodeVector> stages;
+    for (const auto& op : m->get_ordered_ops()) {
+        const auto stage = GetRowStage(op);
+        if (stage < 0)
+            continue;
+        for (const auto& input : op->inputs()) {
+            const auto scalar = ov::as_type_ptr<op::Scalar>(input.get_source_output().get_node_shared_ptr());
+            if (!scalar)
+                continue;
+            const auto scalar_stage = GetRowStage(scalar);
+            if (scalar_stage < 0) {
+                SetRowStage(scalar, stage);
+                stages[stage].push_back(scalar);
+            } else if (scalar_stage != stage) {
+                auto& clone = scalars[{scalar.get(), stage}];
+                if (!clone) {
+                    clone = scalar->clone_with_new_inputs({});
+                    ngraph::copy_runtime_info(scalar, clone);
+                    SetRowStage(clone, stage);
+                    stages[stage].push_back(clone);
+                }
+                input.replace_source_output(clone);
+            }
+        }
+        stages[stage].push_back(op);
+    }
+
+    // every stage is executed after the previous one
+    const NodeVector* previous = nullptr;
+    for (const auto& stage : stages) {
+        if (previous) {
+            for (const auto& op : stage.second) {
+                for (const auto& dependency : *previous)
+                    op->add_control_dependency(dependency);
+            }
+        }
+        previous = &stage.second;
+        remark(10) << "row stage " << stage.first << " has " << stage.second.size() << " ops" << std::endl;
+    }
+
+    return true;
+}
+
+} // namespace pass
+} // namespace snippets
+} // namespace ngraph
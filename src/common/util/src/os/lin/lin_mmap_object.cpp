@@ -0,0 +1,112 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+namespace ov {
+namespace util {
+namespace {
+
+class HandleHolder {
+public:
+    explicit HandleHolder(int fd = -1) : m_fd(fd) {}
+    HandleHolder(const HandleHolder&) = delete;
+    HandleHolder& operator=(const HandleHolder&) = delete;
+    ~HandleHolder() {
+        if (m_fd != -1) {
+            ::close(m_fd);
+        }
+    }
+
+    int get() const noexcept {
+        return m_fd;
+    }
+
+private:
+    int m_fd;
+};
+
+class MapHolder : public MappedMemory {
+public:
+    MapHolder() = default;
+    MapHolder(const MapHolder&) = delete;
+    MapHolder& operator=(const MapHolder&) = delete;
+
+    void set(const std::string& path) {
+        HandleHolder handle(::open(path.c_str(), O_RDONLY | O_CLOEXEC));
+        if (handle.get() == -1) {
+            throw_error("Can not open file " + path + " for mapping");
+        }
+
+        struct stat sb = {};
+        if (::fstat(handle.get(), &sb) == -1) {
+            throw_error("Can not get size of file " + path);
+        }
+        m_size = static_cast<size_t>(sb.st_size);
+        // mmap() of an empty file fails, such a file is represented by an empty region
+        if (m_size == 0) {
+            return;
+        }
+
+        void* data = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, handle.get(), 0);
+        if (data == MAP_FAILED) {
+            m_size = 0;
+            throw_error("Can not create file mapping for " + path);
+        }
+        m_data = static_cast<char*>(data);
+    }
+
+    ~MapHolder() override {
+        if (m_data) {
+            ::munmap(m_data, m_size);
+        }
+    }
+
+    char* data() noexcept override {
+        return m_data;
+    }
+
+    size_t size() const noexcept override {
+        return m_size;
+    }
+
+private:
+    static void throw_error(const std::string& message) {
+        const auto err = errno;
+        std::stringstream ss;
+        ss << message << ", err=" << std::strerror(err);
+        throw std::runtime_error(ss.str());
+    }
+
+    char* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+}  // namespace
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(path);
+    return holder;
+}
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path) {
+    return load_mmap_object(ov::util::wstring_to_string(path));
+}
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,140 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+#include <stdexcept>
+
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+#ifndef NOMINMAX
+#    define NOMINMAX
+#endif
+
+#include <windows.h>
+
+namespace ov {
+namespace util {
+namespace {
+
+class HandleHolder {
+public:
+    explicit HandleHolder(HANDLE handle = INVALID_HANDLE_VALUE) : m_handle(handle) {}
+    HandleHolder(const HandleHolder&) = delete;
+    HandleHolder& operator=(const HandleHolder&) = delete;
+    ~HandleHolder() {
+        if (m_handle != INVALID_HANDLE_VALUE && m_handle != nullptr) {
+            ::CloseHandle(m_handle);
+        }
+    }
+
+    HANDLE get() const noexcept {
+        return m_handle;
+    }
+
+private:
+    HANDLE m_handle;
+};
+
+class MapHolder : public MappedMemory {
+public:
+    MapHolder() = default;
+    MapHolder(const MapHolder&) = delete;
+    MapHolder& operator=(const MapHolder&) = delete;
+
+    void set(const std::string& path) {
+        HandleHolder file(::CreateFileA(path.c_str(),
+                                        GENERIC_READ,
+                                        FILE_SHARE_READ,
+                                        nullptr,
+                                        OPEN_EXISTING,
+                                        FILE_ATTRIBUTE_NORMAL,
+                                        nullptr));
+        map(file.get(), path);
+    }
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+    void set(const std::wstring& path) {
+        HandleHolder file(::CreateFileW(path.c_str(),
+                                        GENERIC_READ,
+                                        FILE_SHARE_READ,
+                                        nullptr,
+                                        OPEN_EXISTING,
+                                        FILE_ATTRIBUTE_NORMAL,
+                                        nullptr));
+        map(file.get(), ov::util::wstring_to_string(path));
+    }
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+    ~MapHolder() override {
+        if (m_data) {
+            ::UnmapViewOfFile(m_data);
+        }
+    }
+
+    char* data() noexcept override {
+        return m_data;
+    }
+
+    size_t size() const noexcept override {
+        return m_size;
+    }
+
+private:
+    void map(HANDLE file, const std::string& path) {
+        if (file == INVALID_HANDLE_VALUE) {
+            throw_error("Can not open file " + path + " for mapping");
+        }
+
+        LARGE_INTEGER file_size;
+        if (!::GetFileSizeEx(file, &file_size)) {
+            throw_error("Can not get size of file " + path);
+        }
+        m_size = static_cast<size_t>(file_size.QuadPart);
+        // CreateFileMapping() of an empty file fails, such a file is represented by an empty region
+        if (m_size == 0) {
+            return;
+        }
+
+        HandleHolder mapping(::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr));
+        if (mapping.get() == nullptr) {
+            m_size = 0;
+            throw_error("Can not create file mapping for " + path);
+        }
+
+        m_data = static_cast<char*>(::MapViewOfFile(mapping.get(), FILE_MAP_READ, 0, 0, 0));
+        if (m_data == nullptr) {
+            m_size = 0;
+            throw_error("Can not map view of file " + path);
+        }
+    }
+
+    static void throw_error(const std::string& message) {
+        std::stringstream ss;
+        ss << message << ", err=" << ::GetLastError();
+        throw std::runtime_error(ss.str());
+    }
+
+    char* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+}  // namespace
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(path);
+    return holder;
+}
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(path);
+    return holder;
+}
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
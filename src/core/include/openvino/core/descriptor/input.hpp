@@ -117,6 +117,9 @@ protected:
     /// \return the tensor for the connected output
     std::shared_ptr<Tensor> get_tensor_ptr();
 
+    /// \brief Registers the connected node as the one which lost a consumer in the topological order caches
+    void mark_source_node_changed();
+
     // owner of an argument node (in lieu of m_arguments)
     std::shared_ptr<Node> m_src_node;
     Node* m_node;    // The node we are an input for
@@ -262,6 +262,7 @@ std::vector<std::shared_ptr<Node>> topological_sort(T root_nodes) {
 // input Model is cloned and returned
 // NodeMap input may contain default node mapping i.e. pre-cloned nodes
 // NodeMap output (by reference) fully maps input and cloned Model ops
+// The data of the constants is immutable, so the cloned constants share it with the input Model
 OPENVINO_API
 std::shared_ptr<ov::Model> clone_model(const ov::Model& func,
                                        std::unordered_map<Node*, std::shared_ptr<Node>>& node_map);
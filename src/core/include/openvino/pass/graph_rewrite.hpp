@@ -7,6 +7,7 @@
 #include <functional>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include "openvino/pass/pass.hpp"
 #include "openvino/pass/pattern/matcher.hpp"
@@ -104,20 +105,18 @@ private:
 /// Graph rewrite pass is used for matcher passes execution on Function.
 /// To register MatcherPass use \sa add_matcher<T>(args) method where T is a MatcherPass
 /// class.
-/// As a default algorithm graph rewrite pass traverse Function in topological order and
-/// applies
-/// registered matcher passes for each node. But if all registered matcher passes have type
-/// based
-/// root node in Matcher pattern then efficient mechanism is used to execute them.
-/// Matcher pattern root is type based if it's operation from opset or
-/// pattern::op::WrapType.
-/// Note: when implementing pattern for Matcher make sure that root node is an operation
-/// from opset
-/// or has ov::pattern::op::WrapType. That will help GraphRewrite to execute matcher
-/// passes more
-/// efficient.
+/// Graph rewrite pass traverses Function in topological order and applies registered
+/// matcher passes for each node. Each node is offered only to the matcher passes with
+/// type based root node in Matcher pattern which type matches the node type and to the
+/// matcher passes which root type is unknown.
+/// Matcher pattern root is type based if it's operation from opset, pattern::op::WrapType
+/// or pattern::op::Or / pattern::op::Label wrapping type based patterns.
+/// Note: when implementing pattern for Matcher make sure that root node is type based.
+/// That will help GraphRewrite to execute matcher passes more efficient.
 
 class OPENVINO_API GraphRewrite : public ModelPass {
+    friend class Manager;
+
 public:
     OPENVINO_RTTI("ov::pass::GraphRewrite");
 
@@ -213,6 +212,12 @@ protected:
     bool m_enable_shape_inference = false;
 
     std::vector<std::shared_ptr<ov::pass::MatcherPass>> m_matchers;
+
+private:
+    // Processes the bodies of the sub-graph operations reached by the traversal (see apply_matcher_passes). It is
+    // set by pass::Manager to process the bodies in parallel, otherwise the bodies are processed one by one by this
+    // pass
+    std::function<void(const std::vector<std::shared_ptr<Model>>&)> m_sub_graphs_runner;
 };
 
 class OPENVINO_API BackwardGraphRewrite : public GraphRewrite {
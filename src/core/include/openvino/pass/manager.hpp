@@ -4,16 +4,47 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <list>
 #include <memory>
+#include <ostream>
+#include <string>
 #include <typeinfo>
+#include <unordered_map>
 #include <vector>
 
+#include "openvino/pass/graph_rewrite.hpp"
 #include "openvino/pass/pass.hpp"
 #include "openvino/pass/validate.hpp"
 
 namespace ov {
 namespace pass {
+/// \brief Profile of a pass collected by pass::Manager when the profiling is enabled.
+///
+/// Passes run by the nested managers (e.g. inside of a ModelPass) and matchers run by a GraphRewrite
+/// are reported as children of the pass that runs them.
+struct PassProfile {
+    /// \brief Name of the pass
+    std::string name;
+    /// \brief Kind of the pass: "ModelPass", "MatcherPass" or "NodePass"
+    std::string type;
+    /// \brief Wall time spent in the pass, including the children
+    double time_ms = 0;
+    /// \brief Number of runs of the pass, for a matcher it is the number of nodes it was applied to
+    size_t calls = 0;
+    /// \brief Number of runs changed the model, for a matcher it is the number of successful matches
+    size_t matches = 0;
+    /// \brief Number of nodes added to the model by the pass (not collected for matchers)
+    size_t nodes_created = 0;
+    /// \brief Number of nodes removed from the model by the pass (not collected for matchers)
+    size_t nodes_removed = 0;
+    /// \brief Growth of the peak resident set size of the process during the pass in KB (not collected
+    /// for matchers)
+    int64_t peak_rss_delta_kb = 0;
+    std::vector<PassProfile> children;
+};
+
 class OPENVINO_API Manager {
 public:
     Manager();
@@ -47,6 +78,31 @@ public:
         return rc;
     }
 
+    /// \brief Register given transformation which reads and changes only the model it is run on,
+    /// i.e. it doesn't touch the nodes of the other models and doesn't keep any state shared
+    /// between the runs. When the parallel mode is enabled (see set_parallel_sub_graphs), the bodies
+    /// of the sub-graph operations (e.g. the bodies of sibling Loop operations or then and else bodies
+    /// of If) are processed by separate instances of the transformation concurrently, the instances are
+    /// created with the copies of args.
+    ///
+    ///     pass::Manager manager;
+    ///     manager.set_parallel_sub_graphs(true);
+    ///     manager.register_local_pass<MyMatcherPass>();
+    ///     manager.run_passes(f);
+    ///
+    /// Only MatcherPass transformations can be registered this way, as their matcher is registered by
+    /// the constructor, so an instance created with the same args is equivalent to the registered one.
+    /// \return shared_ptr to the transformation instance which processes the model
+    template <typename T, bool Enable = true, class... Args>
+    std::shared_ptr<T> register_local_pass(Args&&... args) {
+        static_assert(std::is_base_of<MatcherPass, T>::value, "local pass not derived from MatcherPass");
+        auto rc = register_pass<T, Enable>(args...);
+        m_local_pass_factories[rc.get()] = [args...]() -> std::shared_ptr<MatcherPass> {
+            return std::make_shared<T>(args...);
+        };
+        return rc;
+    }
+
     void run_passes(std::shared_ptr<Model>);
 
     void set_pass_visualization(bool new_state) {
@@ -57,6 +113,36 @@ public:
     /// \param new_state Value "true" enables Validate pass run; "false", otherwise
     void set_per_pass_validation(bool new_state);
 
+    /// \brief Set flag to enable/disable parallel processing of the bodies of the sub-graph
+    /// operations by the transformations registered with register_local_pass. The bodies are still
+    /// processed when the traversal of the model reaches their operation. The bodies of the following
+    /// sub-graph operations are processed together with them if the transformation has no matcher to run
+    /// on the nodes in between, so the model isn't changed in between in the sequential mode either.
+    /// The bodies are processed in parallel if they don't share any node. The result is the same as
+    /// for the sequential processing, only the instance ids (and the default names) of the created
+    /// nodes may differ.
+    /// \param new_state Value "true" enables the parallel mode; "false", otherwise
+    void set_parallel_sub_graphs(bool new_state) {
+        m_parallel_sub_graphs = new_state;
+    }
+
+    /// \brief Set flag to enable/disable collection of the per pass profile by run_passes.
+    /// The profiling is also enabled by OV_PROFILE_PASS_JSON environment variable set to a file
+    /// name, the profile of every top level run_passes call is appended to this file as a JSON line.
+    /// \param new_state Value "true" enables the profiling; "false", otherwise
+    void set_profiling(bool new_state) {
+        m_profiling = new_state;
+    }
+
+    /// \return Profile of the passes collected by the last run_passes call. It is empty unless
+    /// the profiling is enabled.
+    const std::vector<PassProfile>& get_profile() const {
+        return m_profile;
+    }
+
+    /// \brief Writes the profile collected by the last run_passes call to the stream in JSON format
+    void dump_profile(std::ostream& stream) const;
+
     /// \brief Callback is a lambda function that can be used by registered transformations.
     /// The main purpose of this callback is to provide a way for plugins to disable/enable
     /// transformations based on some conditions. In some cases plugins may want not to
@@ -106,10 +192,18 @@ protected:
         return pass;
     }
 
+    void run_on_sub_graphs_in_parallel(const std::shared_ptr<MatcherPass>& pass,
+                                       const std::vector<std::shared_ptr<Model>>& sub_graphs,
+                                       GraphRewrite& graph_rewrite);
+
     std::shared_ptr<PassConfig> m_pass_config;
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
+    std::unordered_map<const PassBase*, std::function<std::shared_ptr<MatcherPass>()>> m_local_pass_factories;
     bool m_visualize = false;
     bool m_per_pass_validation = true;
+    bool m_profiling = false;
+    bool m_parallel_sub_graphs = false;
+    std::vector<PassProfile> m_profile;
 };
 }  // namespace pass
 }  // namespace ov
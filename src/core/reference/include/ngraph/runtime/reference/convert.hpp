@@ -6,6 +6,7 @@
 
 #include <cstddef>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "ngraph/type/float16.hpp"
 
@@ -79,25 +80,34 @@ template <typename TI, typename TO>
 void lp_convert(const TI* arg, TO* out, size_t count, element::Type_t src_type, element::Type_t dst_type) {
     const uint8_t* input = reinterpret_cast<const uint8_t*>(arg);
     uint8_t* output = reinterpret_cast<uint8_t*>(out);
-    for (size_t i = 0; i < count; ++i) {
-        if (dst_type == element::u1) {
-            detail::set_u1(output, i, detail::get_value<uint8_t, TI>(input, i, src_type));
-        } else if (dst_type == element::u4) {
-            detail::set_u4(output, i, detail::get_value<uint8_t, TI>(input, i, src_type));
-        } else if (dst_type == element::i4) {
-            detail::set_i4(output, i, detail::get_value<int8_t, TI>(input, i, src_type));
-        } else {
-            out[i] = detail::get_value<TO, TI>(input, i, src_type);
+    if (dst_type == element::u1 || dst_type == element::u4 || dst_type == element::i4) {
+        for (size_t i = 0; i < count; ++i) {
+            if (dst_type == element::u1) {
+                detail::set_u1(output, i, detail::get_value<uint8_t, TI>(input, i, src_type));
+            } else if (dst_type == element::u4) {
+                detail::set_u4(output, i, detail::get_value<uint8_t, TI>(input, i, src_type));
+            } else {
+                detail::set_i4(output, i, detail::get_value<int8_t, TI>(input, i, src_type));
+            }
         }
+        return;
     }
+    // the destination elements occupy whole bytes, so the chunks can be written in parallel
+    parallel_for(count, parallel_min_chunk, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            out[i] = detail::get_value<TO, TI>(input, i, src_type);
+        }
+    });
 }
 }  // namespace detail
 
 template <typename TI, typename TO>
 typename std::enable_if<!std::is_same<TO, char>::value>::type convert(const TI* arg, TO* out, size_t count) {
-    for (size_t i = 0; i < count; ++i) {
-        out[i] = static_cast<TO>(arg[i]);
-    }
+    parallel_for(count, parallel_min_chunk, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            out[i] = static_cast<TO>(arg[i]);
+        }
+    });
 }
 
 template <>
@@ -112,9 +122,11 @@ void convert<float16, int8_t>(const float16* arg, int8_t* out, size_t count);
 // overload to handle ngraph::boolean (it is stored as char)
 template <typename TI, typename TO>
 typename std::enable_if<std::is_same<TO, char>::value>::type convert(const TI* arg, TO* out, size_t count) {
-    for (size_t i = 0; i < count; ++i) {
-        out[i] = static_cast<char>(static_cast<bool>(arg[i]));
-    }
+    parallel_for(count, parallel_min_chunk, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            out[i] = static_cast<char>(static_cast<bool>(arg[i]));
+        }
+    });
 }
 }  // namespace reference
 
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <stdexcept>
 #include <type_traits>
@@ -58,11 +59,14 @@ typename std::enable_if<std::is_integral<T>::value>::type divide(const T* arg0,
                                                                  const Shape& arg1_shape,
                                                                  const op::AutoBroadcastSpec& broadcast_spec,
                                                                  bool pythondiv) {
+    // the elementwise functor may be executed in parallel, so the divisor is checked upfront (every element
+    // of the divisor contributes to the output unless it is empty)
+    const size_t divisor_size = shape_size(arg1_shape);
+    if (shape_size(arg0_shape) != 0 && std::find(arg1, arg1 + divisor_size, T(0)) != arg1 + divisor_size) {
+        throw std::domain_error("integer division by zero");
+    }
     auto functor = [pythondiv](T x, T y) -> T {
         if (pythondiv) {
-            if (y == 0) {
-                throw std::domain_error("integer division by zero");
-            }
             T quot = x / y;
             T rem = x % y;
             if ((rem != 0) && ((x < 0) != (y < 0))) {
@@ -71,9 +75,6 @@ typename std::enable_if<std::is_integral<T>::value>::type divide(const T* arg0,
                 return quot;
             }
         } else {
-            if (y == 0) {
-                throw std::domain_error("integer division by zero");
-            }
             return x / y;
         }
     };
@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+/// \brief Minimal amount of elements processed by a single thread of the elementwise reference kernels.
+///        The smaller tensors (i.e. the most of the tensors evaluated during the inference) are processed
+///        by the calling thread only, as splitting them costs more than it saves.
+constexpr size_t parallel_min_chunk = 1 << 18;
+
+/// \brief Runs body(i) for every i in [0, nchunks), the calls may be concurrent. Returns once all the calls are done.
+using ParallelForImpl = std::function<void(size_t nchunks, const std::function<void(size_t)>& body)>;
+
+/// \brief Sets the threading used by parallel_for. The reference kernels don't depend on a threading library,
+///        so the chunks are processed by the calling thread until the runtime sets its own implementation.
+///
+/// \param impl Runs the chunks, an empty function restores the sequential processing.
+/// \param max_threads Returns the number of threads available to the calling thread.
+void set_parallel_for_impl(ParallelForImpl impl, std::function<size_t()> max_threads);
+
+namespace detail {
+void parallel_for_chunks(size_t work_amount, size_t min_chunk, const std::function<void(size_t, size_t)>& body);
+}  // namespace detail
+
+/// \brief Splits [0, work_amount) into contiguous chunks of at least min_chunk items and calls
+///        body(begin, end) for every chunk, the chunks are processed in parallel by the implementation
+///        passed to set_parallel_for_impl.
+///
+/// \param work_amount Number of items to process.
+/// \param min_chunk Minimal number of items processed by a single thread.
+/// \param body Function processing the items [begin, end). It must not write to the memory written
+///             by the other chunks. If it throws, the first exception is rethrown by the calling thread
+///             once all the chunks are processed.
+template <typename Functor>
+void parallel_for(size_t work_amount, size_t min_chunk, Functor&& body) {
+    if (work_amount / 2 < min_chunk) {
+        body(size_t(0), work_amount);
+        return;
+    }
+    detail::parallel_for_chunks(work_amount, min_chunk, body);
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
@@ -9,6 +9,7 @@
 
 #include "ngraph/check.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 
 using namespace ngraph;
 
@@ -46,7 +47,9 @@ void reshape_in2(const char* in,
                  const Shape& in_shape,
                  const AxisVector& in_axis_order,
                  const Shape& out_shape,
-                 size_t elem_size) {
+                 size_t elem_size,
+                 size_t begin,
+                 size_t end) {
     size_t size[2];
     size_t in_index[2];
     size_t* map_index[2];
@@ -54,7 +57,7 @@ void reshape_in2(const char* in,
         size[i] = in_shape[in_axis_order[i]];
         map_index[in_axis_order[i]] = &in_index[i];
     }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
+    for (in_index[0] = begin; in_index[0] < end; ++in_index[0]) {
         for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
             // clang-format off
                 memcpy(out,
@@ -72,7 +75,9 @@ void reshape_in3(const char* in,
                  const Shape& in_shape,
                  const AxisVector& in_axis_order,
                  const Shape& out_shape,
-                 size_t elem_size) {
+                 size_t elem_size,
+                 size_t begin,
+                 size_t end) {
     size_t size[3];
     size_t in_index[3];
     size_t* map_index[3];
@@ -80,7 +85,7 @@ void reshape_in3(const char* in,
         size[i] = in_shape[in_axis_order[i]];
         map_index[in_axis_order[i]] = &in_index[i];
     }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
+    for (in_index[0] = begin; in_index[0] < end; ++in_index[0]) {
         for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
             for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2]) {
                 // clang-format off
@@ -101,7 +106,9 @@ void reshape_in4(const char* in,
                  const Shape& in_shape,
                  const AxisVector& in_axis_order,
                  const Shape& out_shape,
-                 size_t elem_size) {
+                 size_t elem_size,
+                 size_t begin,
+                 size_t end) {
     size_t size[4];
     size_t in_index[4];
     size_t* map_index[4];
@@ -109,7 +116,7 @@ void reshape_in4(const char* in,
         size[i] = in_shape[in_axis_order[i]];
         map_index[in_axis_order[i]] = &in_index[i];
     }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
+    for (in_index[0] = begin; in_index[0] < end; ++in_index[0]) {
         for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
             for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2]) {
                 for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3]) {
@@ -133,7 +140,9 @@ void reshape_in5(const char* in,
                  const Shape& in_shape,
                  const AxisVector& in_axis_order,
                  const Shape& out_shape,
-                 size_t elem_size) {
+                 size_t elem_size,
+                 size_t begin,
+                 size_t end) {
     size_t size[5];
     size_t in_index[5];
     size_t* map_index[5];
@@ -141,7 +150,7 @@ void reshape_in5(const char* in,
         size[i] = in_shape[in_axis_order[i]];
         map_index[in_axis_order[i]] = &in_index[i];
     }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
+    for (in_index[0] = begin; in_index[0] < end; ++in_index[0]) {
         for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
             for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2]) {
                 for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3]) {
@@ -168,7 +177,9 @@ void reshape_in6(const char* in,
                  const Shape& in_shape,
                  const AxisVector& in_axis_order,
                  const Shape& out_shape,
-                 size_t elem_size) {
+                 size_t elem_size,
+                 size_t begin,
+                 size_t end) {
     size_t size[6];
     size_t in_index[6];
     size_t* map_index[6];
@@ -176,7 +187,7 @@ void reshape_in6(const char* in,
         size[i] = in_shape[in_axis_order[i]];
         map_index[in_axis_order[i]] = &in_index[i];
     }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
+    for (in_index[0] = begin; in_index[0] < end; ++in_index[0]) {
         for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
             for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2]) {
                 for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3]) {
@@ -200,6 +211,27 @@ void reshape_in6(const char* in,
         }
     }
 }
+// Transposes the slices of the outermost output axis in parallel, every slice is written to its own part of the output
+template <typename Kernel>
+void reshape_in_parallel(Kernel kernel,
+                         const char* in,
+                         char* out,
+                         const Shape& in_shape,
+                         const AxisVector& in_axis_order,
+                         const Shape& out_shape,
+                         size_t elem_size) {
+    const size_t outer = in_shape[in_axis_order[0]];
+    if (outer == 0) {
+        return;
+    }
+    const size_t slice_size = shape_size(in_shape) / outer;
+    const size_t min_slices =
+        std::max(runtime::reference::parallel_min_chunk / std::max(slice_size, size_t(1)), size_t(1));
+    runtime::reference::parallel_for(outer, min_slices, [&](size_t begin, size_t end) {
+        kernel(in, out + begin * slice_size * elem_size, in_shape, in_axis_order, out_shape, elem_size, begin, end);
+    });
+}
+
 bool no_axis_reordering(const AxisVector& axis_order) {
     auto tmp = axis_order;
     std::sort(begin(tmp), end(tmp));
@@ -226,19 +258,19 @@ void runtime::opt_kernel::reshape(const char* in,
         reshape_in1(in, out, in_shape, in_axis_order, out_shape, elem_size);
         break;
     case 2:
-        reshape_in2(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        reshape_in_parallel(reshape_in2, in, out, in_shape, in_axis_order, out_shape, elem_size);
         break;
     case 3:
-        reshape_in3(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        reshape_in_parallel(reshape_in3, in, out, in_shape, in_axis_order, out_shape, elem_size);
         break;
     case 4:
-        reshape_in4(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        reshape_in_parallel(reshape_in4, in, out, in_shape, in_axis_order, out_shape, elem_size);
         break;
     case 5:
-        reshape_in5(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        reshape_in_parallel(reshape_in5, in, out, in_shape, in_axis_order, out_shape, elem_size);
         break;
     case 6:
-        reshape_in6(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        reshape_in_parallel(reshape_in6, in, out, in_shape, in_axis_order, out_shape, elem_size);
         break;
     default:
         reference::reshape(in, out, in_shape, in_axis_order, out_shape, elem_size);
@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+namespace {
+struct ParallelBackend {
+    std::mutex mutex;
+    ParallelForImpl impl;
+    std::function<size_t()> max_threads;
+};
+
+ParallelBackend& get_parallel_backend() {
+    static ParallelBackend backend;
+    return backend;
+}
+}  // namespace
+
+void set_parallel_for_impl(ParallelForImpl impl, std::function<size_t()> max_threads) {
+    auto& backend = get_parallel_backend();
+    std::lock_guard<std::mutex> lock(backend.mutex);
+    backend.impl = std::move(impl);
+    backend.max_threads = std::move(max_threads);
+}
+
+namespace detail {
+void parallel_for_chunks(size_t work_amount, size_t min_chunk, const std::function<void(size_t, size_t)>& body) {
+    ParallelForImpl impl;
+    std::function<size_t()> get_max_threads;
+    {
+        // only the large tensors get here, so the lock costs nothing compared to the work
+        auto& backend = get_parallel_backend();
+        std::lock_guard<std::mutex> lock(backend.mutex);
+        impl = backend.impl;
+        get_max_threads = backend.max_threads;
+    }
+    const size_t max_threads = impl && get_max_threads ? std::max(get_max_threads(), size_t(1)) : 1;
+    const size_t nchunks = std::min(max_threads, work_amount / std::max(min_chunk, size_t(1)));
+    if (nchunks <= 1) {
+        body(0, work_amount);
+        return;
+    }
+
+    const size_t chunk = (work_amount + nchunks - 1) / nchunks;
+    // the exceptions must not leave the worker threads, so the first one is rethrown by the calling thread
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    impl(nchunks, [&](size_t i) {
+        const size_t begin = i * chunk;
+        const size_t end = std::min(begin + chunk, work_amount);
+        if (begin >= end)
+            return;
+        try {
+            body(begin, end);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error)
+                error = std::current_exception();
+        }
+    });
+    if (error)
+        std::rethrow_exception(error);
+}
+}  // namespace detail
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
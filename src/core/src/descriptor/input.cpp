@@ -34,17 +34,19 @@ ov::descriptor::Input::~Input() {
 void ov::descriptor::Input::replace_output(Output& new_output) {
     if (m_output != nullptr) {
         m_output->remove_input(this);
+        mark_source_node_changed();
     }
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<ngraph::Node>(new_output.get_node());
 
     // Output replacement may change the topological order of nodes,
-    // so we have to reset cache by setting a flag into shared node info.
+    // so we have to update cache by registering the node in shared node info.
+    Node* node = m_node;
     for_each(m_node->m_shared_rt_info.cbegin(),
              m_node->m_shared_rt_info.cend(),
-             [](const std::shared_ptr<SharedRTInfo>& info) {
-                 info->set_use_topological_cache(false);
+             [node](const std::shared_ptr<SharedRTInfo>& info) {
+                 info->add_changed_consumer(node);
              });
 }
 
@@ -52,9 +54,22 @@ void ov::descriptor::Input::replace_output(const std::shared_ptr<ov::Node>& node
     replace_output(node->m_outputs.at(i));
 }
 
+void ov::descriptor::Input::mark_source_node_changed() {
+    // The source node lost a consumer and may not belong to the models anymore
+    Node* node = m_src_node.get();
+    if (node == nullptr)
+        return;
+    for_each(node->m_shared_rt_info.cbegin(),
+             node->m_shared_rt_info.cend(),
+             [node](const std::shared_ptr<SharedRTInfo>& info) {
+                 info->add_changed_producer(node);
+             });
+}
+
 void ov::descriptor::Input::remove_output() {
     if (m_output != nullptr) {
         m_output->remove_input(this);
+        mark_source_node_changed();
         m_src_node = nullptr;
         m_output = nullptr;
     }
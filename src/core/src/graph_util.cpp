@@ -236,8 +236,7 @@ std::vector<std::shared_ptr<ngraph::Node>> ngraph::clone_nodes(const std::vector
             auto cloned_node = node->copy_with_new_inputs(cloned_args, cloned_dependencies);
             // There is a friendly name for this node so copy it
             cloned_node->set_friendly_name(node->get_friendly_name());
-            auto rt_info = node->get_rt_info();
-            cloned_node->get_rt_info() = rt_info;
+            cloned_node->get_rt_info() = node->get_rt_info();
 
             for (auto output : node->outputs()) {
                 const auto& output_rt_info = output.get_rt_info();
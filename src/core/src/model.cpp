@@ -3,10 +3,13 @@
 //
 
 #include <algorithm>
+#include <functional>
 #include <list>
 #include <memory>
+#include <queue>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "itt.hpp"
 #include "layout_utils.hpp"
@@ -86,6 +89,238 @@ ngraph::ParameterVector auto_detect_parameters(const std::vector<std::shared_ptr
     return parameter_vector;
 }
 
+std::vector<ov::Node*> get_dependencies(ov::Node* node) {
+    std::vector<ov::Node*> dependencies;
+    for (size_t i = 0; i < node->get_input_size(); ++i) {
+        dependencies.push_back(node->get_input_node_ptr(i));
+    }
+    for (const auto& dependency : node->get_control_dependencies()) {
+        dependencies.push_back(dependency.get());
+    }
+    return dependencies;
+}
+
+std::vector<ov::Node*> get_consumers(ov::Node* node) {
+    std::vector<ov::Node*> consumers;
+    for (const auto& output : node->outputs()) {
+        for (const auto& input : output.get_target_inputs()) {
+            consumers.push_back(input.get_node());
+        }
+    }
+    for (auto* dependent : node->get_control_dependents()) {
+        consumers.push_back(dependent);
+    }
+    return consumers;
+}
+
+/// Updates the topological order after the inputs of the `consumers` were replaced and the `producers` lost
+/// some consumers: the nodes not used by the model anymore are dropped and the new nodes are inserted right
+/// before their first consumer, the rest of the order is kept. The update is done only if every changed
+/// consumer is still placed after its inputs, otherwise the full sort is required and false is returned.
+bool update_topological_order(const std::vector<std::shared_ptr<ov::Node>>& cached_order,
+                              const std::unordered_set<const ov::Node*>& roots,
+                              const std::vector<ov::Node*>& consumers,
+                              const std::vector<ov::Node*>& producers,
+                              std::vector<std::shared_ptr<ov::Node>>& order,
+                              std::vector<std::shared_ptr<ov::Node>>& new_nodes) {
+    // the local update doesn't pay off when a large part of the model is changed
+    if (cached_order.empty() || (consumers.size() + producers.size()) * 4 > cached_order.size())
+        return false;
+
+    std::unordered_map<const ov::Node*, size_t> position;
+    position.reserve(cached_order.size());
+    for (size_t i = 0; i < cached_order.size(); ++i) {
+        position.emplace(cached_order[i].get(), i);
+    }
+
+    // 1. Drop the nodes which lost all the consumers. The candidates are processed from the end of the order,
+    // so the use of the consumers is known by the time the nodes they use are checked.
+    enum class State : uint8_t { none, queued, kept, removed };
+    std::vector<State> state(cached_order.size(), State::none);
+    std::priority_queue<size_t> candidates;
+    auto enqueue = [&](const ov::Node* node) {
+        const auto it = position.find(node);
+        if (it != position.end() && state[it->second] == State::none) {
+            state[it->second] = State::queued;
+            candidates.push(it->second);
+        }
+    };
+    for (auto* node : producers) {
+        enqueue(node);
+    }
+
+    // The nodes outside of the cached order are used if they are consumed by the used nodes
+    enum class Use : uint8_t { none, visiting, used, unused, unknown };
+    std::unordered_map<const ov::Node*, Use> uses;
+    std::function<Use(ov::Node*, size_t)> get_use = [&](ov::Node* node, size_t depth) -> Use {
+        if (roots.count(node))
+            return Use::used;
+        const auto it = position.find(node);
+        if (it != position.end()) {
+            switch (state[it->second]) {
+            case State::removed:
+                return Use::unused;
+            case State::queued:
+                return Use::unknown;
+            default:
+                return Use::used;
+            }
+        }
+        auto& use = uses[node];
+        if (use == Use::visiting)
+            return Use::unused;
+        if (use != Use::none)
+            return use;
+        constexpr size_t max_depth = 1024;
+        if (depth > max_depth)
+            return Use::unknown;
+        use = Use::visiting;
+        Use result = Use::unused;
+        for (auto* consumer : get_consumers(node)) {
+            const auto consumer_use = get_use(consumer, depth + 1);
+            if (consumer_use == Use::used) {
+                result = Use::used;
+                break;
+            }
+            if (consumer_use == Use::unknown)
+                result = Use::unknown;
+        }
+        use = result;
+        return result;
+    };
+
+    while (!candidates.empty()) {
+        const size_t i = candidates.top();
+        candidates.pop();
+        state[i] = State::kept;
+        ov::Node* node = cached_order[i].get();
+        if (roots.count(node))
+            continue;
+        Use use = Use::unused;
+        for (auto* consumer : get_consumers(node)) {
+            const auto consumer_use = get_use(consumer, 0);
+            if (consumer_use == Use::used) {
+                use = Use::used;
+                break;
+            }
+            if (consumer_use == Use::unknown)
+                use = Use::unknown;
+        }
+        if (use == Use::unknown)
+            return false;
+        if (use == Use::unused) {
+            state[i] = State::removed;
+            for (auto* dependency : get_dependencies(node)) {
+                enqueue(dependency);
+            }
+        }
+    }
+
+    // 2. Collect the new nodes used by the changed consumers, the dependencies go first.
+    // Every changed consumer must still be placed after its inputs.
+    std::vector<ov::Node*> new_order;
+    std::unordered_map<const ov::Node*, size_t> slots;  // position of the first consumer for the new nodes
+    std::unordered_set<const ov::Node*> visiting;
+    struct Frame {
+        ov::Node* node;
+        std::vector<ov::Node*> dependencies;
+        size_t next;
+    };
+    std::vector<Frame> stack;
+    for (auto* consumer : consumers) {
+        const auto it = position.find(consumer);
+        if (it == position.end() || state[it->second] == State::removed)
+            continue;
+        stack.push_back({consumer, get_dependencies(consumer), 0});
+        while (!stack.empty()) {
+            auto& frame = stack.back();
+            if (frame.next == frame.dependencies.size()) {
+                auto* node = frame.node;
+                stack.pop_back();
+                if (!position.count(node)) {
+                    visiting.erase(node);
+                    slots.emplace(node, cached_order.size());
+                    new_order.push_back(node);
+                }
+                continue;
+            }
+            auto* dependency = frame.dependencies[frame.next++];
+            const auto dependency_position = position.find(dependency);
+            if (dependency_position != position.end()) {
+                if (state[dependency_position->second] == State::removed)
+                    return false;
+                continue;
+            }
+            if (slots.count(dependency))
+                continue;
+            // a cycle
+            if (!visiting.insert(dependency).second)
+                return false;
+            stack.push_back({dependency, get_dependencies(dependency), 0});
+        }
+    }
+
+    // the new nodes are placed before the first consumer and after the inputs
+    for (auto it = new_order.rbegin(); it != new_order.rend(); ++it) {
+        auto& slot = slots[*it];
+        for (auto* consumer : get_consumers(*it)) {
+            const auto consumer_position = position.find(consumer);
+            if (consumer_position != position.end()) {
+                if (state[consumer_position->second] != State::removed)
+                    slot = std::min(slot, consumer_position->second);
+            } else {
+                const auto consumer_slot = slots.find(consumer);
+                if (consumer_slot != slots.end())
+                    slot = std::min(slot, consumer_slot->second);
+            }
+        }
+    }
+    auto placed_after_inputs = [&](ov::Node* node, size_t slot) {
+        for (auto* dependency : get_dependencies(node)) {
+            const auto it = position.find(dependency);
+            if (it != position.end() && it->second >= slot)
+                return false;
+        }
+        return true;
+    };
+    for (auto* node : new_order) {
+        if (!placed_after_inputs(node, slots[node]))
+            return false;
+    }
+    for (auto* consumer : consumers) {
+        const auto it = position.find(consumer);
+        if (it != position.end() && state[it->second] != State::removed && !placed_after_inputs(consumer, it->second))
+            return false;
+    }
+
+    // 3. Merge the orders
+    std::vector<std::pair<size_t, ov::Node*>> inserts;
+    inserts.reserve(new_order.size());
+    for (auto* node : new_order) {
+        inserts.emplace_back(slots[node], node);
+        new_nodes.push_back(node->shared_from_this());
+    }
+    std::stable_sort(inserts.begin(),
+                     inserts.end(),
+                     [](const std::pair<size_t, ov::Node*>& lhs, const std::pair<size_t, ov::Node*>& rhs) {
+                         return lhs.first < rhs.first;
+                     });
+    order.reserve(cached_order.size() + inserts.size());
+    auto insert = inserts.cbegin();
+    for (size_t i = 0; i < cached_order.size(); ++i) {
+        for (; insert != inserts.cend() && insert->first == i; ++insert) {
+            order.push_back(insert->second->shared_from_this());
+        }
+        if (state[i] != State::removed) {
+            order.push_back(cached_order[i]);
+        }
+    }
+    for (; insert != inserts.cend(); ++insert) {
+        order.push_back(insert->second->shared_from_this());
+    }
+    return true;
+}
+
 }  // namespace
 
 OPENVINO_SUPPRESS_DEPRECATED_START
@@ -279,6 +514,41 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
         return nodes;
     }
 
+    // The graph was changed since the last sort, try to update the cached order around the changed nodes.
+    // A custom sorter may order the nodes differently, so the update is applied to the default sorter only.
+    using default_sorter_t = std::vector<std::shared_ptr<Node>> (*)(std::vector<std::shared_ptr<Node>>);
+    const auto sorter = m_topological_sorter.target<default_sorter_t>();
+    std::vector<Node*> changed_consumers, changed_producers;
+    if (sorter && *sorter == ngraph::topological_sort<std::vector<std::shared_ptr<Node>>> &&
+        m_shared_rt_info->get_topological_changes(changed_consumers, changed_producers)) {
+        for (const auto& node : m_cached_ordered_ops) {
+            if (auto locked_node = node.lock()) {
+                nodes.emplace_back(locked_node);
+            }
+        }
+        std::unordered_set<const Node*> roots;
+        for (const auto& r : get_results()) {
+            roots.insert(r.get());
+        }
+        for (const auto& r : get_sinks()) {
+            roots.insert(r.get());
+        }
+        for (const auto& param : get_parameters()) {
+            roots.insert(param.get());
+        }
+
+        NodeVector order, new_nodes;
+        if (update_topological_order(nodes, roots, changed_consumers, changed_producers, order, new_nodes)) {
+            m_cached_ordered_ops.assign(order.cbegin(), order.cend());
+            for (const auto& node : new_nodes) {
+                node->insert_info(m_shared_rt_info);
+            }
+            m_shared_rt_info->set_use_topological_cache(true);
+            return order;
+        }
+        nodes.clear();
+    }
+
     for (const auto& r : get_results()) {
         nodes.emplace_back(r);
     }
@@ -76,10 +76,13 @@ ov::Node::Node(const OutputVector& arguments, size_t output_size) : Node() {
 
 ov::Node::~Node() {
     try {
-        // raise a flag to reset nodes cache
-        for_each(m_shared_rt_info.cbegin(), m_shared_rt_info.cend(), [](const std::shared_ptr<SharedRTInfo>& info) {
-            info->set_use_topological_cache(false);
-        });
+        // the order of the rest nodes stays valid, the sources of the node are registered
+        // as changed ones when the inputs are removed
+        for_each(m_shared_rt_info.cbegin(),
+                 m_shared_rt_info.cend(),
+                 [this](const std::shared_ptr<SharedRTInfo>& info) {
+                     info->remove_node(this);
+                 });
 
         for (descriptor::Input& input : m_inputs) {
             if (input.has_output()) {
@@ -177,10 +180,12 @@ void ov::Node::set_arguments(const OutputVector& arguments) {
         set_argument(i++, output);
     }
 
-    // set_arguments doesn't use replace_output method, so we have to reset cache manually here
-    for_each(this->m_shared_rt_info.cbegin(), this->m_shared_rt_info.cend(), [](std::shared_ptr<SharedRTInfo> info) {
-        info->set_use_topological_cache(false);
-    });
+    // set_arguments doesn't use replace_output method, so we have to update cache manually here
+    for_each(this->m_shared_rt_info.cbegin(),
+             this->m_shared_rt_info.cend(),
+             [this](std::shared_ptr<SharedRTInfo> info) {
+                 info->add_changed_consumer(this);
+             });
 }
 
 ov::descriptor::Input& ov::Node::get_input_descriptor(size_t position) {
@@ -345,6 +350,13 @@ void ov::Node::remove_control_dependency(std::shared_ptr<Node> node) {
             node->m_control_dependents.erase(it);
         }
     }
+    // the dependency may not belong to the models anymore
+    Node* dependency = node.get();
+    for_each(node->m_shared_rt_info.cbegin(),
+             node->m_shared_rt_info.cend(),
+             [dependency](std::shared_ptr<SharedRTInfo> info) {
+                 info->add_changed_producer(dependency);
+             });
 }
 
 void ov::Node::clear_control_dependencies() {
@@ -353,6 +365,12 @@ void ov::Node::clear_control_dependencies() {
         if (it != node->m_control_dependents.end()) {
             node->m_control_dependents.erase(it);
         }
+        Node* dependency = node.get();
+        for_each(node->m_shared_rt_info.cbegin(),
+                 node->m_shared_rt_info.cend(),
+                 [dependency](std::shared_ptr<SharedRTInfo> info) {
+                     info->add_changed_producer(dependency);
+                 });
     }
     m_control_dependencies.clear();
 }
@@ -7,6 +7,8 @@
 #include <algorithm>
 #include <deque>
 #include <iostream>
+#include <ngraph/pattern/op/label.hpp>
+#include <ngraph/pattern/op/or.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <regex>
 #include <unordered_set>
@@ -16,6 +18,7 @@
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "pass_profile.hpp"
 #include "perf_counters.hpp"
 
 /* GraphRewrite algorithm:
@@ -57,6 +60,41 @@ PerfCounters& perf_counters_graph_rewrite() {
     static PerfCounters counters;
     return counters;
 }
+
+// Collects the types of the nodes the pattern can match. Returns false if the pattern can match
+// a node of any type, i.e. the matcher has to be applied to every node.
+bool collect_root_types(const Output<Node>& pattern_value, std::vector<NodeTypeInfo>& root_types) {
+    auto root = pattern_value.get_node_shared_ptr();
+    // pattern::op::AnyOutput operation automatically appends for multi output operations inside
+    // Matcher and to get actual root node we need to take it's parent.
+    if (auto any_output = std::dynamic_pointer_cast<pattern::op::AnyOutput>(root)) {
+        return collect_root_types(any_output->input_value(0), root_types);
+    }
+    if (auto wrap_type = std::dynamic_pointer_cast<pattern::op::WrapType>(root)) {
+        const auto& wrapped_types = wrap_type->get_wrapped_types();
+        root_types.insert(root_types.end(), wrapped_types.begin(), wrapped_types.end());
+        return true;
+    }
+    // Or matches if any of its branches matches
+    if (auto or_pattern = std::dynamic_pointer_cast<pattern::op::Or>(root)) {
+        for (const auto& branch : or_pattern->input_values()) {
+            if (!collect_root_types(branch, root_types))
+                return false;
+        }
+        return true;
+    }
+    // Label matches the node only if both its predicate and the wrapped pattern match it
+    if (auto label = std::dynamic_pointer_cast<pattern::op::Label>(root)) {
+        return collect_root_types(label->input_value(0), root_types);
+    }
+    // type of the node matched by the other patterns is unknown
+    if (std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
+        return false;
+    }
+    // operation from opset matches the nodes of the same type and the derived ones
+    root_types.push_back(root->get_type_info());
+    return true;
+}
 }  // namespace
 }  // namespace pass
 }  // namespace ov
@@ -86,52 +124,62 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // Index of the matchers by the types of the nodes their root can match. The matchers which can match
+    // a node of any type (e.g. their root is pattern::op::Label with a predicate) are run for every node.
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<size_t> any_type_matchers;
+    std::vector<NodeTypeInfo> root_types;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
         if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
             continue;
 
         auto matcher = m_matchers[matcher_index]->get_matcher();
-        if (!matcher) {
-            all_roots_has_type = false;
-            break;
+        root_types.clear();
+        if (matcher && collect_root_types(matcher->get_pattern_value(), root_types)) {
+            for (const auto& root_type_info : root_types) {
+                auto& matchers = type_to_matcher[root_type_info];
+                // the same matcher may be registered for the type several times through pattern::op::Or
+                if (matchers.empty() || matchers.back() != matcher_index)
+                    matchers.push_back(matcher_index);
+            }
+        } else {
+            any_type_matchers.push_back(matcher_index);
         }
+    }
 
-        auto root = matcher->get_pattern_value().get_node_shared_ptr();
-        // pattern::op::AnyOutput operation automatically appends for multi output operations inside
-        // Matcher and to gen actual root node we need to take it's parent.
-        if (auto any_type = std::dynamic_pointer_cast<pattern::op::AnyOutput>(root)) {
-            root = any_type->input_value(0).get_node_shared_ptr();
-        }
+    // Matchers to run for the nodes of the given type in order of the registration, they are
+    // collected once per type including the matchers registered for the parent types
+    std::unordered_map<const DiscreteTypeInfo*, std::vector<size_t>> matchers_by_node_type;
+    auto get_matchers_to_run = [&](const DiscreteTypeInfo& type_info) -> const std::vector<size_t>& {
+        auto it = matchers_by_node_type.find(&type_info);
+        if (it != matchers_by_node_type.end())
+            return it->second;
 
-        // if root is an operation from opset or has pattern::op::WrapType type then we can extract
-        // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
-        if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
-            if (auto any_type = std::dynamic_pointer_cast<pattern::op::WrapType>(p)) {
-                for (const auto& root_type_info : any_type->get_wrapped_types()) {
-                    type_to_matcher[root_type_info].push_back(matcher_index);
-                }
-            } else {
-                all_roots_has_type = false;
-                break;
+        std::vector<size_t> matcher_passes_to_run = any_type_matchers;
+        for (auto node_type_info = &type_info; node_type_info; node_type_info = node_type_info->parent) {
+            auto matchers = type_to_matcher.find(*node_type_info);
+            if (matchers != type_to_matcher.end()) {
+                matcher_passes_to_run.insert(matcher_passes_to_run.end(),
+                                             matchers->second.begin(),
+                                             matchers->second.end());
             }
-        } else {
-            type_to_matcher[root->get_type_info()].push_back(matcher_index);
         }
+        std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
+        matcher_passes_to_run.erase(std::unique(matcher_passes_to_run.begin(), matcher_passes_to_run.end()),
+                                    matcher_passes_to_run.end());
+        return matchers_by_node_type.emplace(&type_info, std::move(matcher_passes_to_run)).first->second;
+    };
 
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
-    }
+    // Per matcher profile, collected only if the pass is run by pass::Manager with the profiling enabled
+    auto* profiles = profile::current();
+    std::vector<PassProfile> matcher_profiles(profiles ? m_matchers.size() : 0);
 
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
-    auto run_matcher_pass = [&](std::shared_ptr<MatcherPass> m_pass, std::shared_ptr<Node> node) -> bool {
+    auto run_matcher_pass = [&](size_t matcher_index, std::shared_ptr<Node> node) -> bool {
+        const auto& m_pass = m_matchers[matcher_index];
         // Keep this property check for backward compatibility. In future transformation property
         // will be deprecated and removed.
         if (m_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && f->is_dynamic()) {
@@ -144,7 +192,17 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
-        bool status = m_pass->apply(node);
+        bool status;
+        if (profiles) {
+            const auto start = std::chrono::steady_clock::now();
+            status = m_pass->apply(node);
+            auto& matcher_profile = matcher_profiles[matcher_index];
+            matcher_profile.time_ms += profile::elapsed_ms(start);
+            matcher_profile.calls++;
+            matcher_profile.matches += status ? 1 : 0;
+        } else {
+            status = m_pass->apply(node);
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -160,8 +218,18 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
+    auto add_sub_graphs = [](const std::shared_ptr<Node>& node, std::vector<std::shared_ptr<Model>>& sub_graphs) {
+        if (auto sub_graph_node = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node)) {
+            size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
+            for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
+                sub_graphs.push_back(sub_graph_node->get_function(sub_graph_ind));
+            }
+            return true;
+        }
+        return false;
+    };
+    // The sub-graph operations whose bodies were processed together with the bodies of a preceding operation
+    std::unordered_set<const Node*> processed_sub_graph_nodes;
 
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
@@ -172,60 +240,50 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
             continue;
 
         // Recursive apply Matchers for sub-graph based nodes
-        if (auto sub_graph_node = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node)) {
-            size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
-            for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
-                auto sub_graph = sub_graph_node->get_function(sub_graph_ind);
-                run_on_model(sub_graph);
+        std::vector<std::shared_ptr<Model>> sub_graphs;
+        if (processed_sub_graph_nodes.erase(node.get()) == 0 && add_sub_graphs(node, sub_graphs)) {
+            if (m_sub_graphs_runner) {
+                // No matcher runs on the nodes between this operation and the next sub-graph operations up to
+                // the first node which has matchers to run, so their bodies can be processed now as well: nothing
+                // in the model is changed in between in the sequential processing
+                if (get_matchers_to_run(node->get_type_info()).empty()) {
+                    for (const auto& next_weak_node : nodes_to_run) {
+                        auto next_node = next_weak_node.lock();
+                        if (!next_node)
+                            continue;
+                        if (add_sub_graphs(next_node, sub_graphs))
+                            processed_sub_graph_nodes.insert(next_node.get());
+                        if (!get_matchers_to_run(next_node->get_type_info()).empty())
+                            break;
+                    }
+                }
+                m_sub_graphs_runner(sub_graphs);
+            } else {
+                for (const auto& sub_graph : sub_graphs) {
+                    run_on_model(sub_graph);
+                }
             }
         }
         // Temporary keep this GraphRewrite property for backward compatibility
         if (m_enable_shape_inference) {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
-                    rewritten = true;
-                    break;
-                }
+        for (size_t matcher_index : get_matchers_to_run(node->get_type_info())) {
+            if (run_matcher_pass(matcher_index, node)) {
+                rewritten = true;
+                break;
             }
         }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else {
-            for (auto& m_pass : m_matchers) {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
+    }
 
-                if (run_matcher_pass(m_pass, node)) {
-                    rewritten = true;
-                    break;
-                }
-            }
-        }
+    for (size_t matcher_index = 0; matcher_index < matcher_profiles.size(); ++matcher_index) {
+        auto& matcher_profile = matcher_profiles[matcher_index];
+        if (matcher_profile.calls == 0)
+            continue;
+        matcher_profile.name = m_matchers[matcher_index]->get_name();
+        matcher_profile.type = "MatcherPass";
+        // the matchers of the sub-graphs are reported to the same pass
+        profile::merge(*profiles, std::move(matcher_profile));
     }
     return rewritten;
 }
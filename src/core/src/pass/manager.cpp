@@ -5,22 +5,28 @@
 #include "ngraph/pass/manager.hpp"
 
 #include <algorithm>
+#include <exception>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "itt.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/op/util/multi_subgraph_base.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/util.hpp"
 #include "openvino/util/env_util.hpp"
+#include "pass_profile.hpp"
 #include "perf_counters.hpp"
 
 using namespace std;
@@ -32,6 +38,38 @@ PerfCounters& perf_counters() {
     static PerfCounters counters;
     return counters;
 }
+
+const std::string& profile_json_file() {
+    static const std::string file = ov::util::getenv_string("OV_PROFILE_PASS_JSON");
+    return file;
+}
+
+std::vector<std::shared_ptr<Model>> get_sub_graphs(const std::shared_ptr<Model>& model) {
+    std::vector<std::shared_ptr<Model>> sub_graphs;
+    for (const auto& node : model->get_ordered_ops()) {
+        if (auto sub_graph_op = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
+            for (size_t i = 0; i < sub_graph_op->get_internal_subgraphs_size(); ++i) {
+                if (const auto& sub_graph = sub_graph_op->get_function(static_cast<int>(i)))
+                    sub_graphs.push_back(sub_graph);
+            }
+        }
+    }
+    return sub_graphs;
+}
+
+// Adds the nodes of the model and of its nested sub-graphs to the set, returns false if some node
+// is already there
+bool collect_nodes(const std::shared_ptr<Model>& model, std::unordered_set<const Node*>& nodes) {
+    for (const auto& node : model->get_ordered_ops()) {
+        if (!nodes.insert(node.get()).second)
+            return false;
+    }
+    for (const auto& sub_graph : get_sub_graphs(model)) {
+        if (!collect_nodes(sub_graph, nodes))
+            return false;
+    }
+    return true;
+}
 }  // namespace
 }  // namespace pass
 }  // namespace ov
@@ -39,16 +77,83 @@ PerfCounters& perf_counters() {
 ov::pass::Manager::Manager()
     : m_pass_config(std::make_shared<PassConfig>()),
       m_visualize(ov::util::getenv_bool("NGRAPH_ENABLE_VISUALIZE_TRACING") ||
-                  ov::util::getenv_bool("OV_ENABLE_VISUALIZE_TRACING")) {}
+                  ov::util::getenv_bool("OV_ENABLE_VISUALIZE_TRACING")),
+      m_profiling(!profile_json_file().empty()) {}
 
 ov::pass::Manager::~Manager() = default;
 
-ov::pass::Manager::Manager(std::shared_ptr<ov::pass::PassConfig> pass_config) : m_pass_config(std::move(pass_config)) {}
+ov::pass::Manager::Manager(std::shared_ptr<ov::pass::PassConfig> pass_config)
+    : m_pass_config(std::move(pass_config)),
+      m_profiling(!profile_json_file().empty()) {}
 
 void ov::pass::Manager::set_per_pass_validation(bool new_state) {
     m_per_pass_validation = new_state;
 }
 
+void ov::pass::Manager::dump_profile(std::ostream& stream) const {
+    profile::to_json(stream, m_profile);
+}
+
+void ov::pass::Manager::run_on_sub_graphs_in_parallel(const std::shared_ptr<MatcherPass>& pass,
+                                                      const std::vector<std::shared_ptr<Model>>& sub_graphs,
+                                                      GraphRewrite& graph_rewrite) {
+    // the sub-graphs sharing some nodes (e.g. the same body used by several operations) are processed
+    // sequentially
+    bool independent = sub_graphs.size() > 1;
+    std::unordered_set<const Node*> nodes;
+    for (size_t i = 0; independent && i < sub_graphs.size(); ++i) {
+        independent = collect_nodes(sub_graphs[i], nodes);
+    }
+    if (!independent) {
+        for (const auto& sub_graph : sub_graphs) {
+            graph_rewrite.run_on_model(sub_graph);
+        }
+        return;
+    }
+
+    // every sub-graph is processed by its own instance of the pass, the instances are created here as
+    // the constructors of the passes are not required to be thread safe
+    const auto& factory = m_local_pass_factories.at(pass.get());
+    std::vector<std::shared_ptr<GraphRewrite>> passes;
+    for (size_t i = 0; i < sub_graphs.size(); ++i) {
+        auto pass_copy = factory();
+        pass_copy->m_name = pass->m_name;
+        pass_copy->m_property = pass->m_property;
+        pass_copy->set_pass_config(m_pass_config);
+        passes.push_back(std::make_shared<GraphRewrite>(pass_copy));
+    }
+
+    // the results (errors and profiles) are collected per sub-graph and reported in the order of
+    // the sub-graphs, so they don't depend on the scheduling
+    auto* parent_profile = profile::current();
+    std::vector<std::vector<PassProfile>> profiles(sub_graphs.size());
+    std::vector<std::exception_ptr> errors(sub_graphs.size());
+    ngraph::runtime::reference::parallel_for(sub_graphs.size(), 1, [&](size_t begin, size_t end) {
+        auto* thread_profile = profile::current();
+        for (size_t i = begin; i < end; ++i) {
+            profile::current() = parent_profile ? &profiles[i] : nullptr;
+            try {
+                passes[i]->run_on_model(sub_graphs[i]);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+        profile::current() = thread_profile;
+    });
+
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+    if (parent_profile) {
+        for (auto& sub_graph_profiles : profiles) {
+            for (auto& sub_graph_profile : sub_graph_profiles) {
+                profile::merge(*parent_profile, std::move(sub_graph_profile));
+            }
+        }
+    }
+}
+
 void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     NGRAPH_SUPPRESS_DEPRECATED_START
     OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "pass::Manager::run_passes");
@@ -60,6 +165,10 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     ngraph::stopwatch pass_timer;
     ngraph::stopwatch overall_timer;
     overall_timer.start();
+    // the passes run by a nested manager are reported to the profile of the enclosing pass
+    auto* parent_profile = profile::current();
+    const bool profiling = m_profiling || parent_profile;
+    m_profile.clear();
     bool function_changed = false;
     for (auto& pass : m_pass_list) {
         if (m_pass_config->is_disabled(pass->get_type_info())) {
@@ -69,6 +178,10 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
 
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::nGraphPass_LT, pass::perf_counters()[pass->get_type_info()]);
 
+        std::unique_ptr<profile::Scope> profile_scope;
+        if (profiling)
+            profile_scope.reset(new profile::Scope(m_profile, *pass, func));
+
         pass_timer.start();
 
         if (auto matcher_pass = dynamic_pointer_cast<MatcherPass>(pass)) {
@@ -77,17 +190,29 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
             if (matcher_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && func->is_dynamic()) {
                 NGRAPH_DEBUG << "Pass " << pass->get_name() << " requires static shape but the "
                              << "model is dynamic. Skipping this transformation";
+                if (profile_scope)
+                    profile_scope->cancel();
                 continue;
             }
             // GraphRewrite is a temporary container for MatcherPass to make execution
             // on on entire ngraph::Function
-            function_changed = GraphRewrite(matcher_pass).run_on_model(func);
+            GraphRewrite graph_rewrite(matcher_pass);
+            if (m_parallel_sub_graphs && m_local_pass_factories.count(pass.get())) {
+                // the bodies of the sub-graph operations are processed when the traversal reaches them, as in
+                // the sequential mode (the bodies of the following operations may be processed at once)
+                graph_rewrite.m_sub_graphs_runner = [&](const std::vector<std::shared_ptr<Model>>& sub_graphs) {
+                    run_on_sub_graphs_in_parallel(matcher_pass, sub_graphs, graph_rewrite);
+                };
+            }
+            function_changed = graph_rewrite.run_on_model(func);
         } else if (auto function_pass = dynamic_pointer_cast<ModelPass>(pass)) {
             // This checks is to skip the graph transformation when the graph pass relies on
             // static shape but the function state is dynamic.
             if (function_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && func->is_dynamic()) {
                 NGRAPH_DEBUG << "Pass " << pass->get_name() << " requires static shape but the "
                              << "model is dynamic. Skipping this transformation";
+                if (profile_scope)
+                    profile_scope->cancel();
                 continue;
             }
 
@@ -95,6 +220,8 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
                 if (function_changed) {
                     function_pass->run_on_model(func);
                     function_changed = false;
+                } else if (profile_scope) {
+                    profile_scope->cancel();
                 }
             } else {
                 function_changed = function_pass->run_on_model(func);
@@ -103,6 +230,8 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
             if (node_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && func->is_dynamic()) {
                 NGRAPH_DEBUG << "Pass " << pass->get_name() << " requires static shape but the "
                              << "model is dynamic. Skipping this transformation";
+                if (profile_scope)
+                    profile_scope->cancel();
                 continue;
             }
             for (const shared_ptr<Node>& n : func->get_ops()) {
@@ -125,6 +254,10 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
         }
         index++;
         pass_timer.stop();
+        if (profile_scope) {
+            profile_scope->set_changed(function_changed);
+            profile_scope.reset();
+        }
         if (profile_enabled) {
             cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
         }
@@ -132,5 +265,23 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     if (profile_enabled) {
         cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
     }
+    if (parent_profile) {
+        for (const auto& pass_profile : m_profile) {
+            parent_profile->push_back(pass_profile);
+        }
+        if (!m_profiling)
+            m_profile.clear();
+    } else if (m_profiling && !profile_json_file().empty()) {
+        std::ofstream file(profile_json_file(), std::ios::app);
+        if (file.is_open()) {
+            file << "{\"model\":";
+            profile::write_json_string(file, func->get_friendly_name());
+            file << ",\"passes\":";
+            dump_profile(file);
+            file << "}\n";
+        } else {
+            NGRAPH_WARN << "Can't open the pass profile file " << profile_json_file();
+        }
+    }
     NGRAPH_SUPPRESS_DEPRECATED_END
 }
@@ -0,0 +1,160 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pass_profile.hpp"
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+// windows.h must be included before psapi.h
+#    include <psapi.h>
+#else
+#    include <sys/resource.h>
+#endif
+
+#include <algorithm>
+#include <iomanip>
+
+#include "openvino/pass/graph_rewrite.hpp"
+#include "openvino/pass/pass.hpp"
+
+namespace ov {
+namespace pass {
+namespace profile {
+namespace {
+const char* get_pass_type(const PassBase& pass) {
+    if (dynamic_cast<const MatcherPass*>(&pass))
+        return "MatcherPass";
+    if (dynamic_cast<const ModelPass*>(&pass))
+        return "ModelPass";
+    return "NodePass";
+}
+}  // namespace
+
+void write_json_string(std::ostream& stream, const std::string& str) {
+    stream << '"';
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            stream << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+        } else {
+            stream << c;
+        }
+    }
+    stream << '"';
+}
+
+namespace {
+void write_profile(std::ostream& stream, const PassProfile& profile) {
+    stream << "{\"name\":";
+    write_json_string(stream, profile.name);
+    stream << ",\"type\":";
+    write_json_string(stream, profile.type);
+    stream << ",\"time_ms\":" << profile.time_ms << ",\"calls\":" << profile.calls << ",\"matches\":" << profile.matches
+           << ",\"nodes_created\":" << profile.nodes_created << ",\"nodes_removed\":" << profile.nodes_removed
+           << ",\"peak_rss_delta_kb\":" << profile.peak_rss_delta_kb << ",\"children\":";
+    to_json(stream, profile.children);
+    stream << "}";
+}
+}  // namespace
+
+std::vector<PassProfile>*& current() {
+    static thread_local std::vector<PassProfile>* profiles = nullptr;
+    return profiles;
+}
+
+int64_t get_peak_rss_kb() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return static_cast<int64_t>(counters.PeakWorkingSetSize / 1024);
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#    ifdef __APPLE__
+    // ru_maxrss is in bytes on macOS and in KB on Linux
+    return static_cast<int64_t>(usage.ru_maxrss / 1024);
+#    else
+    return static_cast<int64_t>(usage.ru_maxrss);
+#    endif
+#endif
+}
+
+void merge(std::vector<PassProfile>& profiles, PassProfile&& profile) {
+    auto it = std::find_if(profiles.begin(), profiles.end(), [&](const PassProfile& p) {
+        return p.name == profile.name && p.type == profile.type;
+    });
+    if (it == profiles.end()) {
+        profiles.push_back(std::move(profile));
+        return;
+    }
+    it->time_ms += profile.time_ms;
+    it->calls += profile.calls;
+    it->matches += profile.matches;
+    it->nodes_created += profile.nodes_created;
+    it->nodes_removed += profile.nodes_removed;
+    it->peak_rss_delta_kb += profile.peak_rss_delta_kb;
+    for (auto& child : profile.children) {
+        merge(it->children, std::move(child));
+    }
+}
+
+void to_json(std::ostream& stream, const std::vector<PassProfile>& profiles) {
+    stream << "[";
+    for (size_t i = 0; i < profiles.size(); ++i) {
+        if (i != 0)
+            stream << ",";
+        write_profile(stream, profiles[i]);
+    }
+    stream << "]";
+}
+
+Scope::Scope(std::vector<PassProfile>& profiles, const PassBase& pass, const std::shared_ptr<Model>& model)
+    : m_profiles(profiles),
+      m_parent(current()),
+      m_model(model),
+      m_peak_rss_kb(get_peak_rss_kb()) {
+    m_profile.name = pass.get_name();
+    m_profile.type = get_pass_type(pass);
+    m_profile.calls = 1;
+    if (m_model) {
+        for (const auto& node : m_model->get_ops()) {
+            m_node_ids.insert(node->get_instance_id());
+        }
+    }
+    current() = &m_profile.children;
+    m_start = std::chrono::steady_clock::now();
+}
+
+Scope::~Scope() {
+    m_profile.time_ms = elapsed_ms(m_start);
+    current() = m_parent;
+    if (m_canceled)
+        return;
+
+    if (m_model) {
+        // the scope may be destroyed by an exception thrown from the pass, the model can be invalid then
+        try {
+            const auto ops = m_model->get_ops();
+            size_t kept = 0;
+            for (const auto& node : ops) {
+                if (m_node_ids.count(node->get_instance_id()))
+                    ++kept;
+            }
+            m_profile.nodes_created = ops.size() - kept;
+            m_profile.nodes_removed = m_node_ids.size() - kept;
+        } catch (...) {
+        }
+    }
+    m_profile.peak_rss_delta_kb = get_peak_rss_kb() - m_peak_rss_kb;
+    m_profiles.push_back(std::move(m_profile));
+}
+}  // namespace profile
+}  // namespace pass
+}  // namespace ov
@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "openvino/pass/manager.hpp"
+
+namespace ov {
+namespace pass {
+namespace profile {
+/// \brief Returns the list the profiles of the currently running passes are appended to,
+/// nullptr if the profiling is disabled for the current thread
+std::vector<PassProfile>*& current();
+
+/// \brief Returns the peak resident set size of the process in KB or 0 if it is unknown
+int64_t get_peak_rss_kb();
+
+inline double elapsed_ms(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/// \brief Adds the profile to the list, the profile is merged to the entry of the same pass if it exists
+void merge(std::vector<PassProfile>& profiles, PassProfile&& profile);
+
+void write_json_string(std::ostream& stream, const std::string& str);
+
+void to_json(std::ostream& stream, const std::vector<PassProfile>& profiles);
+
+/// \brief Collects the profile of a single pass run. The nested passes are reported to the children
+/// of this pass while the scope exists, the profile is added to the enclosing list on destruction.
+class Scope {
+public:
+    Scope(std::vector<PassProfile>& profiles, const PassBase& pass, const std::shared_ptr<Model>& model);
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    void set_changed(bool changed) {
+        m_profile.matches = changed ? 1 : 0;
+    }
+
+    /// \brief The pass was skipped, so it is not reported
+    void cancel() {
+        m_canceled = true;
+    }
+
+private:
+    std::vector<PassProfile>& m_profiles;
+    std::vector<PassProfile>* m_parent;
+    PassProfile m_profile;
+    std::shared_ptr<Model> m_model;
+    std::unordered_set<size_t> m_node_ids;
+    int64_t m_peak_rss_kb;
+    std::chrono::steady_clock::time_point m_start;
+    bool m_canceled = false;
+};
+}  // namespace profile
+}  // namespace pass
+}  // namespace ov
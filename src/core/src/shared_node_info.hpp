@@ -4,24 +4,116 @@
 
 #pragma once
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <openvino/core/except.hpp>
 #include <openvino/core/node.hpp>
+#include <unordered_map>
+#include <vector>
 
 namespace ov {
 class SharedRTInfo {
 public:
-    SharedRTInfo() : m_use_topological_cache(false) {}
+    SharedRTInfo() : m_use_topological_cache(false), m_can_update_topological_cache(false) {}
 
+    /// \brief Marks the cached topological order as valid (true) or as requiring the full sort (false).
     void set_use_topological_cache(bool status) {
         m_use_topological_cache = status;
+        m_can_update_topological_cache = status;
+        m_changed_consumers.clear();
+        m_changed_producers.clear();
     }
 
     bool get_use_topological_cache() const {
         return m_use_topological_cache;
     }
 
+    /// \brief Records the node whose inputs were replaced, the cached topological order
+    ///        is updated around such nodes instead of the full sort.
+    void add_changed_consumer(Node* node) {
+        m_use_topological_cache = false;
+        m_changed_consumers.add(node, m_can_update_topological_cache);
+        check_changes_count();
+    }
+
+    /// \brief Records the node which lost a consumer, so it may not belong to the model anymore.
+    ///        The order itself stays valid, so the cache is not reset.
+    void add_changed_producer(Node* node) {
+        m_changed_producers.add(node, m_can_update_topological_cache);
+        check_changes_count();
+    }
+
+    /// \brief Forgets the destroyed node.
+    void remove_node(Node* node) {
+        m_changed_consumers.remove(node);
+        m_changed_producers.remove(node);
+    }
+
+    /// \brief Returns the nodes changed since the last topological sort in the order of the changes or false
+    ///        if the cached order can't be updated and the full sort is required.
+    bool get_topological_changes(std::vector<Node*>& consumers, std::vector<Node*>& producers) const {
+        if (!m_can_update_topological_cache)
+            return false;
+        m_changed_consumers.get(consumers);
+        m_changed_producers.get(producers);
+        return true;
+    }
+
 private:
+    // The changed nodes in the order of the first change, so the update of the order doesn't depend on
+    // the addresses of the nodes. Like the rest of the graph modifications, it isn't thread safe.
+    class ChangedNodes {
+    public:
+        void add(Node* node, bool tracked) {
+            if (tracked && m_positions.emplace(node, m_nodes.size()).second)
+                m_nodes.push_back(node);
+        }
+
+        void remove(Node* node) {
+            const auto it = m_positions.find(node);
+            if (it != m_positions.end()) {
+                m_nodes[it->second] = nullptr;
+                m_positions.erase(it);
+            }
+        }
+
+        void get(std::vector<Node*>& nodes) const {
+            nodes.clear();
+            nodes.reserve(m_positions.size());
+            std::copy_if(m_nodes.begin(), m_nodes.end(), std::back_inserter(nodes), [](Node* node) {
+                return node != nullptr;
+            });
+        }
+
+        size_t size() const {
+            return m_nodes.size();
+        }
+
+        void clear() {
+            m_nodes.clear();
+            m_positions.clear();
+        }
+
+    private:
+        std::vector<Node*> m_nodes;
+        std::unordered_map<Node*, size_t> m_positions;
+    };
+
+    void check_changes_count() {
+        // too many changes are cheaper to handle by the full sort
+        if (m_changed_consumers.size() + m_changed_producers.size() > max_tracked_changes) {
+            m_can_update_topological_cache = false;
+            m_changed_consumers.clear();
+            m_changed_producers.clear();
+        }
+    }
+
+    static constexpr size_t max_tracked_changes = 1 << 16;
+
     bool m_use_topological_cache;
+    bool m_can_update_topological_cache;
+    ChangedNodes m_changed_consumers;
+    ChangedNodes m_changed_producers;
 };
 }  // namespace ov
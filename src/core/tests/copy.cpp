@@ -436,3 +436,23 @@ TEST(copy, random_uniform) {
     ASSERT_TRUE(ru->get_op_seed() == node_cast->get_op_seed());
     ASSERT_TRUE(ru->get_state() == node_cast->get_state());
 }
+
+TEST(copy, clone_model_shares_constant_data) {
+    auto param = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto constant = op::Constant::create(element::f32, Shape{2, 3}, {1, 2, 3, 4, 5, 6});
+    auto add = make_shared<op::v1::Add>(param, constant);
+    auto f = make_shared<Function>(OutputVector{add}, ParameterVector{param});
+
+    auto clone = ov::clone_model(*f);
+    auto clone_add = clone->get_results()[0]->get_input_node_shared_ptr(0);
+    auto clone_constant = ov::as_type_ptr<op::Constant>(clone_add->get_input_node_shared_ptr(1));
+    ASSERT_NE(clone_constant, nullptr);
+    EXPECT_NE(clone_constant, constant);
+    EXPECT_EQ(clone_constant->get_data_ptr(), constant->get_data_ptr());
+
+    // the original model keeps the data when the clone is released
+    clone.reset();
+    clone_add.reset();
+    clone_constant.reset();
+    EXPECT_EQ(constant->cast_vector<float>(), (std::vector<float>{1, 2, 3, 4, 5, 6}));
+}
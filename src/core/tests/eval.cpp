@@ -2,9 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
 #include <cmath>
 #include <cstddef>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "engines_util/execute_tools.hpp"
@@ -25,6 +27,7 @@
 #include "ngraph/op/convert.hpp"
 #include "ngraph/op/cos.hpp"
 #include "ngraph/op/cosh.hpp"
+#include "ngraph/op/divide.hpp"
 #include "ngraph/op/erf.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/floor.hpp"
@@ -33,6 +36,7 @@
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/min.hpp"
 #include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/non_zero.hpp"
 #include "ngraph/op/not.hpp"
@@ -57,6 +61,7 @@
 #include "ngraph/op/topk.hpp"
 #include "ngraph/op/unsqueeze.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/validation_util.hpp"
 #include "util/all_close_f.hpp"
 #include "util/ndarray.hpp"
@@ -647,6 +652,113 @@ TEST(eval, evaluate_convert) {
     }
 }
 
+namespace {
+// Runs the chunks of the reference kernels by the threads created per call while it's alive,
+// the kernels are sequential by default as the runtime threading is set only by the Core
+class ThreadsParallelFor {
+public:
+    ThreadsParallelFor() {
+        runtime::reference::set_parallel_for_impl(
+            [this](size_t nchunks, const std::function<void(size_t)>& body) {
+                m_chunks += nchunks;
+                std::vector<std::thread> threads;
+                for (size_t i = 1; i < nchunks; i++)
+                    threads.emplace_back(body, i);
+                body(0);
+                for (auto& thread : threads)
+                    thread.join();
+            },
+            [] {
+                return size_t(4);
+            });
+    }
+    ~ThreadsParallelFor() {
+        runtime::reference::set_parallel_for_impl(nullptr, nullptr);
+    }
+
+    size_t get_chunks() const {
+        return m_chunks;
+    }
+
+private:
+    std::atomic<size_t> m_chunks{0};
+};
+}  // namespace
+
+TEST(eval, evaluate_large_sequential_by_default) {
+    const Shape shape{1024, 1024};
+    auto p0 = make_shared<op::Parameter>(element::f32, shape);
+    auto p1 = make_shared<op::Parameter>(element::f32, shape);
+    auto add = make_shared<op::v1::Add>(p0, p1);
+    auto fun = make_shared<Function>(OutputVector{add}, ParameterVector{p0, p1});
+
+    std::vector<float> data(shape_size(shape), 1.f);
+    size_t calls = 0;
+    runtime::reference::set_parallel_for_impl(nullptr, [&calls] {
+        ++calls;
+        return size_t(4);
+    });
+    auto result = make_shared<HostTensor>();
+    ASSERT_TRUE(fun->evaluate({result},
+                              {make_host_tensor<element::Type_t::f32>(shape, data),
+                               make_host_tensor<element::Type_t::f32>(shape, data)}));
+    runtime::reference::set_parallel_for_impl(nullptr, nullptr);
+    // no threading is used without the implementation
+    EXPECT_EQ(calls, 0);
+    EXPECT_EQ(read_vector<float>(result), std::vector<float>(shape_size(shape), 2.f));
+}
+
+TEST(eval, evaluate_weights_decompression_large) {
+    ThreadsParallelFor threads;
+    // u8 weights with per output channel scales, big enough to be evaluated by several threads
+    const Shape shape{1024, 1024};
+    auto p = make_shared<op::Parameter>(element::u8, shape);
+    auto convert = make_shared<op::v0::Convert>(p, element::f32);
+    auto scale = make_shared<op::Parameter>(element::f32, Shape{1024, 1});
+    auto multiply = make_shared<op::v1::Multiply>(convert, scale);
+    auto fun = make_shared<Function>(OutputVector{multiply}, ParameterVector{p, scale});
+
+    std::vector<uint8_t> weights(shape_size(shape));
+    for (size_t i = 0; i < weights.size(); i++)
+        weights[i] = static_cast<uint8_t>(i % 251);
+    std::vector<float> scales(shape[0]);
+    for (size_t i = 0; i < scales.size(); i++)
+        scales[i] = 0.5f * (i % 7);
+
+    auto result = make_shared<HostTensor>();
+    ASSERT_TRUE(fun->evaluate({result},
+                              {make_host_tensor<element::Type_t::u8>(shape, weights),
+                               make_host_tensor<element::Type_t::f32>(Shape{1024, 1}, scales)}));
+    EXPECT_EQ(result->get_element_type(), element::f32);
+    EXPECT_EQ(result->get_shape(), shape);
+    auto result_data = read_vector<float>(result);
+    std::vector<float> expected(weights.size());
+    for (size_t i = 0; i < expected.size(); i++)
+        expected[i] = weights[i] * scales[i / shape[1]];
+    ASSERT_EQ(result_data, expected);
+    EXPECT_GT(threads.get_chunks(), 1);
+}
+
+TEST(eval, evaluate_divide_by_zero_large) {
+    ThreadsParallelFor threads;
+    // big enough to be evaluated by several threads, the error must still reach the caller
+    const Shape shape{1024, 1024};
+    auto p0 = make_shared<op::Parameter>(element::i32, shape);
+    auto p1 = make_shared<op::Parameter>(element::i32, Shape{1, 1024});
+    auto divide = make_shared<op::v1::Divide>(p0, p1);
+    auto fun = make_shared<Function>(OutputVector{divide}, ParameterVector{p0, p1});
+
+    std::vector<int32_t> dividend(shape_size(shape), 6);
+    std::vector<int32_t> divisor(shape[1], 3);
+    divisor.back() = 0;
+
+    auto result = make_shared<HostTensor>();
+    EXPECT_THROW(fun->evaluate({result},
+                               {make_host_tensor<element::Type_t::i32>(shape, dividend),
+                                make_host_tensor<element::Type_t::i32>(Shape{1, 1024}, divisor)}),
+                 std::domain_error);
+}
+
 TEST(eval, evaluate_abs) {
     auto p = make_shared<op::Parameter>(element::f32, Shape{2, 3});
     auto abs = make_shared<op::Abs>(p);
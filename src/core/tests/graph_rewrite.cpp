@@ -7,6 +7,8 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 #include <util/test_tools.hpp>
 
 NGRAPH_SUPPRESS_DEPRECATED_START
@@ -265,6 +267,47 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2) {
     ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
 }
 
+class CountMatchesPass : public ngraph::pass::MatcherPass {
+public:
+    CountMatchesPass(const std::shared_ptr<Node>& pattern, size_t& matches) : MatcherPass() {
+        ngraph::matcher_pass_callback callback = [&matches](pattern::Matcher& m) {
+            ++matches;
+            return false;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(pattern, "CountMatchesPass");
+        this->register_matcher(m, callback);
+    }
+};
+
+TEST(GraphRewriteTest, TypeBasedMatcherPassOrLabel) {
+    auto f = get_function();
+
+    // the predicate is checked only for the nodes offered to the matcher
+    size_t offered = 0;
+    auto divide = std::make_shared<pattern::op::Label>(
+        element::f32,
+        PartialShape::dynamic(),
+        [&offered](const Output<Node>&) {
+            ++offered;
+            return true;
+        },
+        OutputVector{pattern::wrap_type<opset3::Divide>()});
+    auto root = std::make_shared<pattern::op::Or>(OutputVector{divide, pattern::wrap_type<opset3::Multiply>()});
+
+    NodeVector order;
+    size_t matches = 0;
+    Anchor anchor;
+    // the matcher of any node doesn't force the typed matchers to be applied to every node
+    anchor.add_matcher<GatherNodesPass>(order);
+    anchor.add_matcher<CountMatchesPass>(root, matches);
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(order.size(), 4);
+    ASSERT_EQ(offered, 1);
+    ASSERT_EQ(matches, 1);
+}
+
 TEST(PassConfigTest, Test1) {
     {
         auto f = get_function();
@@ -442,3 +485,38 @@ TEST(GraphRewriteTest, nodes_use_count) {
     m.register_pass<CheckConsumers>();
     ASSERT_NO_THROW(m.run_passes(f));
 }
+
+TEST(GraphRewriteTest, MatcherPassProfile) {
+    auto f = get_function();
+
+    NodeVector order;
+    pass::Manager manager;
+    manager.set_profiling(true);
+    auto anchor = manager.register_pass<Anchor>();
+    anchor->add_matcher<TestPass>();
+    anchor->add_matcher<GatherNodesPass>(order);
+    manager.get_pass_config()->set_callback<TestPass>(get_callback());
+    manager.run_passes(f);
+
+    // Anchor and Validate run after it as the model was changed
+    const auto& profile = manager.get_profile();
+    ASSERT_EQ(profile.size(), 2);
+    EXPECT_EQ(profile[0].type, "ModelPass");
+    EXPECT_EQ(profile[0].calls, 1);
+    EXPECT_EQ(profile[0].matches, 1);
+    // Divide and its constant are replaced with Relu
+    EXPECT_EQ(profile[0].nodes_created, 1);
+    EXPECT_EQ(profile[0].nodes_removed, 2);
+
+    // TestPass is applied to every node, GatherNodesPass - to the nodes not matched by TestPass
+    const auto& matchers = profile[0].children;
+    ASSERT_EQ(matchers.size(), 2);
+    EXPECT_EQ(matchers[0].name, "TestMatcher");
+    EXPECT_EQ(matchers[0].type, "MatcherPass");
+    EXPECT_EQ(matchers[0].calls, 4);
+    EXPECT_EQ(matchers[0].matches, 1);
+    EXPECT_EQ(matchers[1].name, "GatherNodesPass");
+    EXPECT_EQ(matchers[1].calls, 3);
+    EXPECT_EQ(matchers[1].matches, 0);
+    EXPECT_EQ(order.size(), 3);
+}
@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/mmap_object.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+
+#include "util/test_common.hpp"
+
+class MmapObjectTest : public ov::test::TestsCommon {
+protected:
+    const std::string m_file_path = GetTestName() + "_" + GetTimestamp() + ".bin";
+
+    void TearDown() override {
+        std::remove(m_file_path.c_str());
+    }
+
+    void write_file(const std::string& content) {
+        std::ofstream file(m_file_path, std::ios::binary);
+        file << content;
+    }
+};
+
+TEST_F(MmapObjectTest, MapsFileContent) {
+    const std::string content = "weights content";
+    write_file(content);
+
+    auto mapped = ov::util::load_mmap_object(m_file_path);
+    ASSERT_NE(nullptr, mapped);
+    ASSERT_EQ(content.size(), mapped->size());
+    EXPECT_EQ(content, std::string(mapped->data(), mapped->size()));
+}
+
+TEST_F(MmapObjectTest, MappingOutlivesFileRemoval) {
+    const std::string content = "weights content";
+    write_file(content);
+
+    auto mapped = ov::util::load_mmap_object(m_file_path);
+#ifndef _WIN32
+    std::remove(m_file_path.c_str());
+#endif
+    EXPECT_EQ(content, std::string(mapped->data(), mapped->size()));
+}
+
+TEST_F(MmapObjectTest, MapsEmptyFile) {
+    write_file("");
+
+    auto mapped = ov::util::load_mmap_object(m_file_path);
+    ASSERT_NE(nullptr, mapped);
+    EXPECT_EQ(0, mapped->size());
+}
+
+TEST_F(MmapObjectTest, ThrowsOnMissingFile) {
+    EXPECT_THROW(ov::util::load_mmap_object(m_file_path + ".missing"), std::runtime_error);
+}
@@ -1377,6 +1377,165 @@ TEST(model, topological_sort_caching_shared_nodes) {
     ASSERT_FALSE(f2_shared_info->get_use_topological_cache());
 }
 
+namespace {
+std::vector<std::shared_ptr<ov::Node>> create_relu_chain(const std::shared_ptr<ov::Node>& input, size_t length) {
+    std::vector<std::shared_ptr<ov::Node>> chain{input};
+    for (size_t i = 0; i < length; ++i) {
+        chain.push_back(std::make_shared<ov::opset8::Relu>(chain.back()));
+    }
+    return chain;
+}
+
+// Checks that the cached order contains the same nodes as the full sort and every node goes after its inputs
+void check_ordered_ops(const std::shared_ptr<ov::Model>& f) {
+    const auto ordered_ops = f->get_ordered_ops();
+    ov::NodeVector roots;
+    for (const auto& result : f->get_results())
+        roots.push_back(result);
+    for (const auto& param : f->get_parameters())
+        roots.push_back(param);
+    const auto sorted_ops = ov::topological_sort(roots);
+    ASSERT_EQ(ordered_ops.size(), sorted_ops.size());
+    ASSERT_EQ(std::set<std::shared_ptr<ov::Node>>(ordered_ops.begin(), ordered_ops.end()),
+              std::set<std::shared_ptr<ov::Node>>(sorted_ops.begin(), sorted_ops.end()));
+
+    std::set<ov::Node*> visited;
+    for (const auto& op : ordered_ops) {
+        for (const auto& input : op->input_values())
+            ASSERT_TRUE(visited.count(input.get_node())) << op << " goes before its input " << input.get_node();
+        visited.insert(op.get());
+    }
+    ASSERT_TRUE(all_ops_have_same_info(f));
+}
+}  // namespace
+
+TEST(model, topological_sort_caching_update_replace_node_with_subgraph) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto chain = create_relu_chain(arg0, 32);
+    auto result = std::make_shared<ov::opset8::Result>(chain.back());
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+
+    auto constant = ov::opset8::Constant::create(ov::element::f32, ov::Shape{1}, {2});
+    auto add = std::make_shared<ov::opset8::Add>(chain[15], constant);
+    auto abs = std::make_shared<ov::opset8::Abs>(add);
+    ov::replace_node(chain[16], abs);
+
+    ASSERT_FALSE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops().size(), 36);
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    check_ordered_ops(f);
+}
+
+TEST(model, topological_sort_caching_update_remove_node) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto chain = create_relu_chain(arg0, 32);
+    auto result = std::make_shared<ov::opset8::Result>(chain.back());
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+
+    // the removed nodes are still alive
+    chain[20]->input(0).replace_source_output(chain[10]);
+
+    ASSERT_FALSE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops().size(), 25);
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    check_ordered_ops(f);
+
+    // the removed nodes are used again
+    chain[20]->input(0).replace_source_output(chain[19]);
+    ASSERT_EQ(f->get_ordered_ops().size(), 34);
+    check_ordered_ops(f);
+}
+
+TEST(model, topological_sort_caching_update_input_from_later_node) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto chain0 = create_relu_chain(arg0, 16);
+    auto chain1 = create_relu_chain(arg0, 16);
+    auto concat = std::make_shared<ov::opset8::Concat>(ov::OutputVector{chain0.back(), chain1.back()}, 0);
+    auto result = std::make_shared<ov::opset8::Result>(concat);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+    check_ordered_ops(f);
+
+    // one of the branches is placed after the other one, so the order may have to be changed
+    chain0[8]->input(0).replace_source_output(chain1[12]);
+    check_ordered_ops(f);
+
+    // the bypassed nodes are used again
+    chain1[8]->input(0).replace_source_output(chain0[7]);
+    check_ordered_ops(f);
+}
+
+TEST(model, topological_sort_caching_update_destroyed_node) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto chain = create_relu_chain(arg0, 32);
+    auto shared_relu = chain[10];
+    auto result = std::make_shared<ov::opset8::Result>(chain.back());
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    chain.clear();
+
+    // the nodes between the bypassed ones are destroyed, the rest of the removed nodes stay alive
+    const auto last = result->get_input_node_shared_ptr(0);
+    last->input(0).replace_source_output(shared_relu);
+    ASSERT_EQ(f->get_ordered_ops().size(), 13);
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    check_ordered_ops(f);
+}
+
+TEST(model, topological_sort_caching_update_is_deterministic) {
+    // The new nodes share the first consumer, the concat which goes before the rest of the consumers,
+    // so their order is defined by the order of the changes.
+    // The models are kept alive to place the nodes of every model at different addresses.
+    constexpr size_t branches_count = 8;
+    const std::vector<size_t> changes_order{3, 6, 0, 5, 2, 7, 1, 4};
+    std::vector<std::shared_ptr<ov::Model>> models;
+    auto get_updated_order = [&]() {
+        auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+        auto chain = create_relu_chain(arg0, 4);
+        auto concat = std::make_shared<ov::opset8::Concat>(ov::OutputVector(branches_count, chain[1]), 0);
+        // the rest of the model is large enough to update the order instead of the full sort
+        ov::OutputVector outputs{concat, create_relu_chain(arg0, 64).back()};
+        std::vector<std::shared_ptr<ov::Node>> consumers;
+        for (size_t i = 0; i < branches_count; ++i) {
+            consumers.push_back(std::make_shared<ov::opset8::Add>(concat, chain.back()));
+            outputs.push_back(consumers.back());
+        }
+        auto f = std::make_shared<ov::Model>(outputs, ov::ParameterVector{arg0});
+        f->get_ordered_ops();
+
+        std::vector<std::shared_ptr<ov::Node>> new_nodes;
+        for (size_t i = 0; i < branches_count; ++i) {
+            new_nodes.push_back(std::make_shared<ov::opset8::Abs>(chain[1]));
+            new_nodes.back()->set_friendly_name("abs_" + std::to_string(i));
+        }
+        for (auto i : changes_order)
+            consumers[i]->input(1).replace_source_output(new_nodes[i]);
+        for (size_t i = 0; i < branches_count; ++i)
+            concat->input(i).replace_source_output(new_nodes[i]);
+
+        std::vector<std::string> names;
+        for (const auto& op : f->get_ordered_ops()) {
+            if (ov::is_type<ov::opset8::Abs>(op))
+                names.push_back(op->get_friendly_name());
+        }
+        EXPECT_TRUE(ov::ModelAccessor(f).get_shared_info()->get_use_topological_cache());
+        check_ordered_ops(f);
+        models.push_back(f);
+        return names;
+    };
+
+    std::vector<std::string> expected;
+    for (auto i : changes_order)
+        expected.push_back("abs_" + std::to_string(i));
+    for (size_t i = 0; i < 4; ++i)
+        ASSERT_EQ(get_updated_order(), expected);
+}
+
 namespace bs_utils {
 static std::shared_ptr<ov::Model> create_n_inputs(ov::element::Type type,
                                                   const std::vector<ov::PartialShape>& shapes,
@@ -2,16 +2,24 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <chrono>
+#include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "engines_util/execute_tools.hpp"
 #include "gtest/gtest.h"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/opsets/opset8.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pattern/op/wrap_type.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+#include "util/graph_comparator.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -42,3 +50,322 @@ public:
     }
 };
 }  // namespace
+
+namespace {
+class AddAbsPass : public pass::FunctionPass {
+public:
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override {
+        auto result = f->get_results().front();
+        auto abs = make_shared<op::Abs>(result->input_value(0));
+        result->input(0).replace_source_output(abs);
+        return true;
+    }
+};
+
+class NestedManagerPass : public pass::FunctionPass {
+public:
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override {
+        pass::Manager manager;
+        manager.register_pass<AddAbsPass>();
+        manager.register_pass<DummyPass>();
+        manager.run_passes(f);
+        return true;
+    }
+};
+}  // namespace
+
+TEST(pass_manager, profile) {
+    auto graph = make_test_graph();
+
+    pass::Manager pass_manager;
+    pass_manager.run_passes(graph);
+    EXPECT_TRUE(pass_manager.get_profile().empty());
+
+    pass_manager.set_per_pass_validation(false);
+    pass_manager.set_profiling(true);
+    pass_manager.register_pass<DummyPass>();
+    pass_manager.register_pass<NestedManagerPass>();
+    pass_manager.run_passes(graph);
+
+    // the passes of the nested manager are reported as children of the pass that runs it
+    const auto& profile = pass_manager.get_profile();
+    ASSERT_EQ(profile.size(), 2);
+    EXPECT_EQ(profile[0].type, "ModelPass");
+    EXPECT_EQ(profile[0].matches, 0);
+    EXPECT_TRUE(profile[0].children.empty());
+    EXPECT_EQ(profile[1].matches, 1);
+    EXPECT_EQ(profile[1].nodes_created, 1);
+    EXPECT_EQ(profile[1].nodes_removed, 0);
+    // Validate runs only after AddAbsPass which changed the model
+    ASSERT_EQ(profile[1].children.size(), 3);
+    EXPECT_EQ(profile[1].children[0].nodes_created, 1);
+    EXPECT_EQ(profile[1].children[2].nodes_created, 0);
+
+    stringstream json;
+    pass_manager.dump_profile(json);
+    EXPECT_EQ(json.str().front(), '[');
+    EXPECT_EQ(json.str().back(), ']');
+    EXPECT_NE(json.str().find("\"nodes_created\":1"), string::npos);
+    EXPECT_NE(json.str().find("\"children\":[{"), string::npos);
+}
+
+namespace {
+class ReplaceNegativeWithAbs : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ReplaceNegativeWithAbs");
+    ReplaceNegativeWithAbs() {
+        auto negative = pattern::wrap_type<opset8::Negative>();
+        matcher_pass_callback callback = [](pattern::Matcher& m) {
+            auto node = m.get_match_root();
+            auto abs = make_shared<opset8::Abs>(node->input_value(0));
+            replace_node(node, abs);
+            return true;
+        };
+        register_matcher(make_shared<pattern::Matcher>(negative, "ReplaceNegativeWithAbs"), callback);
+    }
+};
+
+struct MatchLog {
+    mutex guard;
+    vector<string> names;
+};
+
+class LogMatches : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("LogMatches");
+    explicit LogMatches(const shared_ptr<MatchLog>& log) {
+        auto node = pattern::wrap_type<opset8::Negative, opset8::If>();
+        matcher_pass_callback callback = [log](pattern::Matcher& m) {
+            lock_guard<mutex> lock(log->guard);
+            log->names.push_back(m.get_match_root()->get_friendly_name());
+            return false;
+        };
+        register_matcher(make_shared<pattern::Matcher>(node, "LogMatches"), callback);
+    }
+};
+
+shared_ptr<Function> make_if_function(size_t if_count) {
+    auto data = make_shared<opset8::Parameter>(element::f32, Shape{2});
+    auto condition = opset8::Constant::create(element::boolean, Shape{}, {true});
+    OutputVector outputs;
+    for (size_t i = 0; i < if_count; ++i) {
+        auto then_param = make_shared<opset8::Parameter>(element::f32, Shape{2});
+        auto then_body = make_shared<Function>(OutputVector{make_shared<opset8::Negative>(then_param)},
+                                               ParameterVector{then_param});
+        auto else_param = make_shared<opset8::Parameter>(element::f32, Shape{2});
+        auto else_negative = make_shared<opset8::Negative>(make_shared<opset8::Negative>(else_param));
+        auto else_body = make_shared<Function>(OutputVector{else_negative}, ParameterVector{else_param});
+
+        auto if_op = make_shared<opset8::If>(condition);
+        if_op->set_then_body(then_body);
+        if_op->set_else_body(else_body);
+        if_op->set_input(data, then_param, else_param);
+        outputs.push_back(if_op->set_output(then_body->get_results()[0], else_body->get_results()[0]));
+    }
+    return make_shared<Function>(outputs, ParameterVector{data});
+}
+}  // namespace
+
+TEST(pass_manager, parallel_sub_graphs) {
+    auto f = make_if_function(4);
+    pass::Manager pass_manager;
+    pass_manager.set_parallel_sub_graphs(true);
+    pass_manager.register_local_pass<ReplaceNegativeWithAbs>();
+    pass_manager.run_passes(f);
+
+    auto f_ref = make_if_function(4);
+    pass::Manager ref_pass_manager;
+    ref_pass_manager.register_pass<ReplaceNegativeWithAbs>();
+    ref_pass_manager.run_passes(f_ref);
+
+    for (const auto& op : f->get_ops()) {
+        if (auto if_op = as_type_ptr<opset8::If>(op)) {
+            EXPECT_EQ(count_ops_of_type<opset8::Negative>(if_op->get_then_body()), 0);
+            EXPECT_EQ(count_ops_of_type<opset8::Abs>(if_op->get_else_body()), 2);
+        }
+    }
+    const auto res = FunctionsComparator::with_default().enable(FunctionsComparator::ATTRIBUTES).compare(f, f_ref);
+    ASSERT_TRUE(res.valid) << res.message;
+}
+
+TEST(pass_manager, parallel_sub_graphs_shared_body) {
+    // the bodies sharing the nodes are processed sequentially
+    auto f = make_if_function(2);
+    std::vector<shared_ptr<opset8::If>> ifs;
+    for (const auto& op : f->get_ops()) {
+        if (auto if_op = as_type_ptr<opset8::If>(op))
+            ifs.push_back(if_op);
+    }
+    ASSERT_EQ(ifs.size(), 2);
+    ifs[1]->set_else_body(ifs[0]->get_else_body());
+
+    pass::Manager pass_manager;
+    pass_manager.set_parallel_sub_graphs(true);
+    pass_manager.register_local_pass<ReplaceNegativeWithAbs>();
+    pass_manager.run_passes(f);
+
+    for (const auto& if_op : ifs) {
+        EXPECT_EQ(count_ops_of_type<opset8::Negative>(if_op->get_then_body()), 0);
+        EXPECT_EQ(count_ops_of_type<opset8::Negative>(if_op->get_else_body()), 0);
+    }
+}
+
+TEST(pass_manager, parallel_sub_graphs_order) {
+    // the bodies are processed when the traversal reaches their operation, as in the sequential mode
+    auto f = make_if_function(2);
+    auto negative = make_shared<opset8::Negative>(f->get_results()[0]->input_value(0));
+    negative->set_friendly_name("outer_negative");
+    f->get_results()[0]->input(0).replace_source_output(negative);
+    for (const auto& op : f->get_ordered_ops()) {
+        if (auto if_op = as_type_ptr<opset8::If>(op))
+            if_op->set_friendly_name("if_" + to_string(if_op->get_instance_id()));
+    }
+
+    auto log = make_shared<MatchLog>();
+    pass::Manager pass_manager;
+    pass_manager.set_parallel_sub_graphs(true);
+    pass_manager.register_local_pass<LogMatches>(log);
+    pass_manager.run_passes(f);
+
+    // 2 If operations with 3 Negative operations in their bodies, and the outer Negative
+    ASSERT_EQ(log->names.size(), 2 * 4 + 1);
+    for (size_t i : {size_t(3), size_t(7)}) {
+        EXPECT_EQ(log->names[i].rfind("if_", 0), 0) << log->names[i];
+    }
+    EXPECT_EQ(log->names.back(), "outer_negative");
+}
+
+namespace {
+// Runs the chunks by the threads created per call and records the number of the chunks of every call,
+// the sub-graphs are processed sequentially by default as the runtime threading is set only by the Core
+class ThreadsParallelFor {
+public:
+    explicit ThreadsParallelFor(size_t max_threads = 4) {
+        runtime::reference::set_parallel_for_impl(
+            [this](size_t nchunks, const std::function<void(size_t)>& body) {
+                {
+                    lock_guard<mutex> lock(m_guard);
+                    m_calls.push_back(nchunks);
+                }
+                vector<thread> threads;
+                for (size_t i = 1; i < nchunks; i++)
+                    threads.emplace_back(body, i);
+                body(0);
+                for (auto& t : threads)
+                    t.join();
+            },
+            [max_threads] {
+                return max_threads;
+            });
+    }
+    ~ThreadsParallelFor() {
+        runtime::reference::set_parallel_for_impl(nullptr, nullptr);
+    }
+
+    vector<size_t> get_calls() {
+        lock_guard<mutex> lock(m_guard);
+        return m_calls;
+    }
+
+private:
+    mutex m_guard;
+    vector<size_t> m_calls;
+};
+
+// Loop with the body of negatives_count Negative operations
+shared_ptr<opset8::Loop> make_loop(const Output<Node>& data, size_t negatives_count, const string& name) {
+    auto body_param = make_shared<opset8::Parameter>(element::f32, Shape{2});
+    Output<Node> body_output = body_param;
+    for (size_t i = 0; i < negatives_count; ++i) {
+        body_output = make_shared<opset8::Negative>(body_output);
+        body_output.get_node()->set_friendly_name(name + "_negative_" + to_string(i));
+    }
+    auto body_condition = opset8::Constant::create(element::boolean, Shape{1}, {true});
+    auto body = make_shared<Function>(OutputVector{body_condition, body_output}, ParameterVector{body_param});
+
+    auto trip_count = opset8::Constant::create(element::i64, Shape{1}, {1});
+    auto exec_condition = opset8::Constant::create(element::boolean, Shape{1}, {true});
+    auto loop = make_shared<opset8::Loop>(trip_count, exec_condition);
+    loop->set_function(body);
+    loop->set_special_body_ports(opset8::Loop::SpecialBodyPorts{-1, 0});
+    loop->set_invariant_input(body_param, data);
+    loop->get_iter_value(body_output, -1);
+    loop->set_friendly_name(name);
+    return loop;
+}
+
+// Sibling Loop operations reading the same input
+shared_ptr<Function> make_loops_function(size_t loop_count, size_t negatives_count) {
+    auto data = make_shared<opset8::Parameter>(element::f32, Shape{2});
+    OutputVector outputs;
+    for (size_t i = 0; i < loop_count; ++i) {
+        outputs.push_back(make_loop(data, negatives_count, "loop" + to_string(i))->output(0));
+    }
+    return make_shared<Function>(outputs, ParameterVector{data});
+}
+}  // namespace
+
+TEST(pass_manager, parallel_sub_graphs_sibling_loops) {
+    ThreadsParallelFor threads;
+    auto f = make_loops_function(4, 2);
+    pass::Manager pass_manager;
+    pass_manager.set_parallel_sub_graphs(true);
+    pass_manager.register_local_pass<ReplaceNegativeWithAbs>();
+    pass_manager.run_passes(f);
+    // no matcher runs on the outer nodes, so the bodies of all the loops are processed at once
+    EXPECT_EQ(threads.get_calls(), vector<size_t>{4});
+
+    auto f_ref = make_loops_function(4, 2);
+    pass::Manager ref_pass_manager;
+    ref_pass_manager.register_pass<ReplaceNegativeWithAbs>();
+    ref_pass_manager.run_passes(f_ref);
+
+    const auto res = FunctionsComparator::with_default().enable(FunctionsComparator::ATTRIBUTES).compare(f, f_ref);
+    ASSERT_TRUE(res.valid) << res.message;
+}
+
+TEST(pass_manager, parallel_sub_graphs_sibling_loops_order) {
+    // the outer Negative is matched after the body of the first loop and before the body of the second one
+    ThreadsParallelFor threads;
+    auto data = make_shared<opset8::Parameter>(element::f32, Shape{2});
+    auto loop0 = make_loop(data, 2, "loop0");
+    auto negative = make_shared<opset8::Negative>(loop0->output(0));
+    negative->set_friendly_name("outer_negative");
+    auto loop1 = make_loop(negative, 2, "loop1");
+    auto loop2 = make_loop(negative, 2, "loop2");
+    auto f = make_shared<Function>(OutputVector{loop1->output(0), loop2->output(0)}, ParameterVector{data});
+
+    auto log = make_shared<MatchLog>();
+    pass::Manager pass_manager;
+    pass_manager.set_parallel_sub_graphs(true);
+    pass_manager.register_local_pass<LogMatches>(log);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(log->names.size(), 3 * 2 + 1);
+    EXPECT_EQ(log->names[0].rfind("loop0_", 0), 0) << log->names[0];
+    EXPECT_EQ(log->names[1].rfind("loop0_", 0), 0) << log->names[1];
+    EXPECT_EQ(log->names[2], "outer_negative");
+    // the bodies of loop1 and loop2 are processed together
+    EXPECT_EQ(threads.get_calls(), vector<size_t>{2});
+}
+
+// Compares the time of the sequential and the parallel processing of the bodies of sibling Loop operations,
+// run with --gtest_also_run_disabled_tests
+TEST(pass_manager, DISABLED_parallel_sub_graphs_benchmark) {
+    const size_t loop_count = 8, negatives_count = 20000;
+    auto run = [&](bool parallel) {
+        auto f = make_loops_function(loop_count, negatives_count);
+        pass::Manager pass_manager;
+        pass_manager.set_parallel_sub_graphs(parallel);
+        pass_manager.register_local_pass<ReplaceNegativeWithAbs>();
+        const auto start = chrono::steady_clock::now();
+        pass_manager.run_passes(f);
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    };
+    ThreadsParallelFor threads(std::max(thread::hardware_concurrency(), 1u));
+    const double sequential_ms = run(false);
+    const double parallel_ms = run(true);
+    cout << loop_count << " loops of " << negatives_count << " nodes, " << thread::hardware_concurrency()
+         << " threads: sequential " << sequential_ms << " ms, parallel " << parallel_ms << " ms, speedup "
+         << sequential_ms / parallel_ms << endl;
+}
@@ -220,3 +220,30 @@ INSTANTIATE_TEST_SUITE_P(reshape_opt_kernel_ref_impl_fallback,
                                                           {11, 21, 13, 23, 15, 25},
                                                           {12, 22, 14, 24, 16, 26},
                                                       }}));
+
+TEST(reshape_opt_kernel, large_transpose) {
+    // big enough to be transposed by several threads
+    const Shape in_shape{64, 96, 128};
+    const AxisVector axis_order{2, 0, 1};
+    const Shape out_shape{128, 64, 96};
+    std::vector<ElementValue> input(shape_size(in_shape));
+    std::iota(input.begin(), input.end(), 0);
+
+    std::vector<ElementValue> expected(input.size());
+    for (size_t i = 0; i < in_shape[0]; ++i) {
+        for (size_t j = 0; j < in_shape[1]; ++j) {
+            for (size_t k = 0; k < in_shape[2]; ++k) {
+                expected[(k * in_shape[0] + i) * in_shape[1] + j] = input[(i * in_shape[1] + j) * in_shape[2] + k];
+            }
+        }
+    }
+
+    std::vector<ElementValue> output(input.size());
+    runtime::opt_kernel::reshape((const char*)input.data(),
+                                 (char*)output.data(),
+                                 in_shape,
+                                 axis_order,
+                                 out_shape,
+                                 sizeof(ElementValue));
+    EXPECT_EQ(expected, output);
+}
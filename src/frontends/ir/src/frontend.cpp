@@ -12,7 +12,9 @@
 #include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "so_extension.hpp"
+#include "streaming_weights_buffer.hpp"
 #include "xml_parse_utils.h"
 
 using namespace ov;
@@ -57,6 +59,16 @@ size_t GetIRVersion(std::istream& model) {
     return 0;
 }
 
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+inline std::string weights_path_to_string(const std::wstring& path) {
+    return ov::util::wstring_to_string(path);
+}
+#else
+inline const std::string& weights_path_to_string(const std::string& path) {
+    return path;
+}
+#endif
+
 }  // namespace
 
 bool FrontEnd::supported_impl(const std::vector<ov::Any>& variants) const {
@@ -115,6 +127,9 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     std::ifstream local_model_stream;
     std::istream* provided_model_stream = nullptr;
     std::shared_ptr<ngraph::runtime::AlignedBuffer> weights;
+    // Weights file is mapped into memory by default, so it is shared via page cache between processes
+    // and is read lazily on first access. Pass `false` as one of the parameters to read it into a private buffer.
+    bool enable_mmap = true;
 
     auto create_extensions_map = [&]() -> std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> {
         std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> exts;
@@ -179,6 +194,8 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
 #endif
         } else if (variant.is<std::shared_ptr<ngraph::runtime::AlignedBuffer>>()) {
             weights = variant.as<std::shared_ptr<ngraph::runtime::AlignedBuffer>>();
+        } else if (variant.is<bool>()) {
+            enable_mmap = variant.as<bool>();
         }
     }
 
@@ -199,27 +216,35 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     }
 
     if (!weights_path.empty()) {
-        std::ifstream bin_stream;
-        bin_stream.open(weights_path, std::ios::binary);
-        if (!bin_stream.is_open())
-#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-            IE_THROW() << "Weights file " + ov::util::wstring_to_string(weights_path) + " cannot be opened!";
-#else
-            IE_THROW() << "Weights file " + weights_path + " cannot be opened!";
-#endif
-
-        bin_stream.seekg(0, std::ios::end);
-        size_t file_size = bin_stream.tellg();
-        bin_stream.seekg(0, std::ios::beg);
-
-        auto aligned_weights_buffer = std::make_shared<ngraph::runtime::AlignedBuffer>(file_size);
-        bin_stream.read(aligned_weights_buffer->get_ptr<char>(), aligned_weights_buffer->size());
-        bin_stream.close();
-
-        weights = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
-            aligned_weights_buffer->get_ptr<char>(),
-            aligned_weights_buffer->size(),
-            aligned_weights_buffer);
+        if (enable_mmap) {
+            std::shared_ptr<ov::util::MappedMemory> mapped_memory;
+            try {
+                mapped_memory = ov::util::load_mmap_object(weights_path);
+            } catch (const std::exception& ex) {
+                IE_THROW() << "Weights file " + weights_path_to_string(weights_path) + " cannot be mapped: "
+                           << ex.what();
+            }
+            weights = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+                mapped_memory->data(),
+                mapped_memory->size(),
+                mapped_memory);
+        } else {
+            std::ifstream bin_stream;
+            bin_stream.open(weights_path, std::ios::binary);
+            if (!bin_stream.is_open())
+                IE_THROW() << "Weights file " + weights_path_to_string(weights_path) + " cannot be opened!";
+
+            bin_stream.seekg(0, std::ios::end);
+            size_t file_size = bin_stream.tellg();
+            bin_stream.close();
+
+            // the weights are read in the background while the XML is parsed and the nodes are constructed
+            weights = std::make_shared<StreamingWeightsBuffer>(
+                [weights_path]() {
+                    return std::unique_ptr<std::istream>(new std::ifstream(weights_path, std::ios::binary));
+                },
+                file_size);
+        }
     }
 
     return create_input_model();
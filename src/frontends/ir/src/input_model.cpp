@@ -11,7 +11,9 @@
 #include <openvino/op/util/framework_node.hpp>
 #include <pugixml.hpp>
 
+#include "itt.hpp"
 #include "openvino/core/validation_util.hpp"
+#include "streaming_weights_buffer.hpp"
 
 using namespace ngraph;
 using namespace InferenceEngine;
@@ -201,6 +203,7 @@ public:
                      const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions)
         : m_weights(weights),
           m_extensions(extensions) {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::V10Reader_RT, "ParseXml");
         pugi::xml_parse_result res = m_xml_doc.load(stream);
         if (res.status != pugi::status_ok) {
             IE_THROW() << res.description() << " at offset " << res.offset;
@@ -238,6 +241,9 @@ std::shared_ptr<Function> InputModel::InputModelIRImpl::convert() {
     std::shared_ptr<ngraph::Function> function;
     visitor.on_attribute("net", function);
     function->get_rt_info()["version"] = int64_t(version);
+    // the weights not referenced by the constants are read anyway, wait for them to surface the reading errors
+    if (auto streaming_weights = std::dynamic_pointer_cast<StreamingWeightsBuffer>(m_weights))
+        streaming_weights->wait_all();
     ParsePreProcess(m_root, m_weights, function);
 
     return function;
@@ -7,9 +7,11 @@
 #include <pugixml.hpp>
 
 #include "ie_ngraph_utils.hpp"
+#include "itt.hpp"
 #include "ngraph/op/util/framework_node.hpp"
 #include "ngraph/opsets/opset1.hpp"
 #include "rt_info_deserializer.hpp"
+#include "streaming_weights_buffer.hpp"
 #include "transformations/rt_info/attributes.hpp"
 #include "utils.hpp"
 #include "xml_parse_utils.h"
@@ -344,6 +346,9 @@ void XmlDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<
                 IE_THROW() << "Incorrect weights in bin file!";
             if (size < std::ceil(ngraph::shape_size(shape) * el_type.bitwidth() / 8.f))
                 IE_THROW() << "Attribute and shape size are inconsistent for " << type << " op!";
+            // the nodes may read the constant data on construction, so it has to be loaded already
+            if (auto streaming_weights = std::dynamic_pointer_cast<ov::frontend::ir::StreamingWeightsBuffer>(m_weights))
+                streaming_weights->wait(offset, size);
 
             char* data = m_weights->get_ptr<char>() + offset;
             auto buffer =
@@ -402,7 +407,7 @@ void XmlDeserializer::on_adapter(const std::string& name,
 std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     const pugi::xml_node& root,
     const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights) {
-    // OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::V10Reader_RT, "V10Parser", "Parse");
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::V10Reader_RT, "V10Parser", "Parse");
 
     struct FunctionNodes {
         ngraph::ParameterVector parameters;
@@ -467,7 +472,7 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     };
     std::for_each(outputs.begin(), outputs.end(), dfs);
 
-    // OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConstructNgraphNodes");
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConstructNgraphNodes");
 
     FunctionNodes func_nodes;
     std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
@@ -529,7 +534,7 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
         func_nodes.all.emplace_back(node);
     }
 
-    // OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConstructNgraphFunction");
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConstructNgraphFunction");
 
     auto function = std::make_shared<ngraph::Function>(func_nodes.results,
                                                        func_nodes.sinks,
@@ -0,0 +1,120 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "streaming_weights_buffer.hpp"
+
+#include <algorithm>
+#include <thread>
+
+#include "ie_common.h"
+#include "itt.hpp"
+#include "threading/ie_executor_manager.hpp"
+
+namespace ov {
+namespace frontend {
+namespace ir {
+
+namespace {
+// big enough to keep the reads sequential, small enough to let the first constants go without waiting long
+constexpr size_t chunk_size = 4 * 1024 * 1024;
+constexpr size_t max_readers = 8;
+
+size_t chunks_count(size_t byte_size) {
+    return (byte_size + chunk_size - 1) / chunk_size;
+}
+}  // namespace
+
+StreamingWeightsBuffer::StreamingWeightsBuffer(StreamFactory open_stream, size_t byte_size)
+    : AlignedBuffer(byte_size),
+      m_open_stream(std::move(open_stream)),
+      m_chunk_ready(chunks_count(byte_size), false) {
+    const size_t hw_threads = std::max(1u, std::thread::hardware_concurrency());
+    const size_t readers = std::min({hw_threads, max_readers, m_chunk_ready.size()});
+    if (!readers)
+        return;
+    // every stream runs one reader, the executor stays busy (not reused) until the readers are done
+    m_executor = InferenceEngine::executorManager()->getIdleCPUStreamsExecutor(
+        InferenceEngine::IStreamsExecutor::Config{"IRWeightsReader",
+                                                  static_cast<int>(readers),
+                                                  1 /*single thread per stream*/,
+                                                  InferenceEngine::IStreamsExecutor::ThreadBindingType::NONE});
+    m_readers.reserve(readers);
+    for (size_t i = 0; i < readers; i++) {
+        auto reader = std::make_shared<std::packaged_task<void()>>([this] {
+            read_chunks();
+        });
+        m_readers.emplace_back(reader->get_future());
+        m_executor->run([reader] {
+            (*reader)();
+        });
+    }
+}
+
+StreamingWeightsBuffer::~StreamingWeightsBuffer() {
+    m_stop = true;
+    for (auto& reader : m_readers)
+        reader.wait();
+}
+
+void StreamingWeightsBuffer::wait_all() {
+    wait(0, size());
+    for (auto& reader : m_readers)
+        reader.wait();
+    m_executor.reset();
+}
+
+void StreamingWeightsBuffer::read_chunks() {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::V10Reader_RT, "ReadWeights");
+    try {
+        std::unique_ptr<std::istream> stream;
+        // the chunks are taken in the increasing order, so the weights of the first layers come first
+        for (size_t chunk = m_next_chunk++; chunk < m_chunk_ready.size() && !m_stop; chunk = m_next_chunk++) {
+            if (!stream) {
+                stream = m_open_stream();
+                if (!stream || !stream->good())
+                    IE_THROW() << "Weights file cannot be opened!";
+            }
+            const size_t offset = chunk * chunk_size;
+            const size_t size = std::min(chunk_size, m_byte_size - offset);
+            stream->seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+            stream->read(m_aligned_buffer + offset, static_cast<std::streamsize>(size));
+            if (static_cast<size_t>(stream->gcount()) != size)
+                IE_THROW() << "Weights file is truncated: failed to read " << size << " bytes at offset " << offset;
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_chunk_ready[chunk] = true;
+            m_chunk_ready_cv.notify_all();
+        }
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_error)
+            m_error = std::current_exception();
+        m_stop = true;
+        m_chunk_ready_cv.notify_all();
+    }
+}
+
+void StreamingWeightsBuffer::wait(size_t offset, size_t size) const {
+    if (size == 0 || offset >= m_byte_size)
+        return;
+    const size_t first = offset / chunk_size;
+    const size_t last = (std::min(offset + size, m_byte_size) - 1) / chunk_size;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto is_ready = [&] {
+        return m_error || std::all_of(m_chunk_ready.begin() + first, m_chunk_ready.begin() + last + 1, [](bool ready) {
+                   return ready;
+               });
+    };
+    if (!is_ready()) {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::V10Reader_RT, "WaitWeights");
+        m_chunk_ready_cv.wait(lock, is_ready);
+    }
+    if (m_error)
+        std::rethrow_exception(m_error);
+}
+
+}  // namespace ir
+}  // namespace frontend
+}  // namespace ov
@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <future>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "threading/ie_istreams_executor.hpp"
+
+namespace ov {
+namespace frontend {
+namespace ir {
+
+/**
+ * @brief Weights buffer which is filled from the weights file in chunks by the streams of a CPU streams executor
+ * (taken from the executor manager) in the background.
+ * The readers of the buffer wait only for the chunks covering the data they access, so the XML parsing and
+ * the nodes construction overlap with the weights reading
+ */
+class StreamingWeightsBuffer : public ngraph::runtime::AlignedBuffer {
+public:
+    using StreamFactory = std::function<std::unique_ptr<std::istream>()>;
+
+    /**
+     * @param open_stream is called by every reading thread to open its own stream of the weights file
+     * @param byte_size is the size of the weights file
+     */
+    StreamingWeightsBuffer(StreamFactory open_stream, size_t byte_size);
+    ~StreamingWeightsBuffer() override;
+
+    /**
+     * @brief Blocks until the [offset, offset + size) range of the buffer is read
+     * @throws the error which happened during the reading of the range
+     */
+    void wait(size_t offset, size_t size) const;
+
+    /**
+     * @brief Blocks until the whole buffer is read, then releases the executor, so it can be reused by the next reading
+     */
+    void wait_all();
+
+private:
+    void read_chunks();
+
+    StreamFactory m_open_stream;
+    InferenceEngine::IStreamsExecutor::Ptr m_executor;
+    std::vector<std::future<void>> m_readers;
+    std::atomic<size_t> m_next_chunk{0};
+    std::atomic<bool> m_stop{false};
+    mutable std::mutex m_mutex;
+    mutable std::condition_variable m_chunk_ready_cv;
+    std::vector<bool> m_chunk_ready;
+    std::exception_ptr m_error;
+};
+
+}  // namespace ir
+}  // namespace frontend
+}  // namespace ov
@@ -9,6 +9,9 @@
 
 #pragma once
 
+#include <map>
+#include <string>
+
 #include "ie_plugin_config.hpp"
 #include "openvino/runtime/properties.hpp"
 
@@ -47,12 +50,39 @@ DECLARE_CONFIG_KEY(LP_TRANSFORMS_MODE);
 DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
 
 /**
- * @brief Defines how many records can be stored in the CPU runtime parameters cache per CPU runtime parameter type per
- * stream
+ * @brief Enables lending of the idle CPU Executor Streams threads to the busy stream's `parallel_for` calls
+ * (on the same NUMA node). Supported values: CONFIG_VALUE(YES), CONFIG_VALUE(NO) (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_STREAMS_WORK_STEALING);
+
+/**
+ * @brief Defines how many records can be stored in the CPU runtime parameters cache per CPU runtime parameter type.
+ * The cache is shared between all the streams of an executable network
  * @ingroup ie_dev_api_plugin_api
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Defines the time in milliseconds the CPU plugin may spend at compile time to choose the number of streams for
+ * the THROUGHPUT performance hint by measuring the throughput of a few candidates instead of the static heuristics.
+ * The choice is stored in the model cache directory if the cache is enabled. Zero (default) disables the calibration
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_STREAMS_CALIBRATION_TIME);
+
+/**
+ * @brief Defines how the CPU plugin places the (reordered) constant weights on a multi-socket system:
+ *  - REPLICATE (default) - every NUMA node keeps its own copy of the weights used by the streams of the node
+ *  - INTERLEAVE - a single copy of the weights with the memory pages interleaved between the NUMA nodes
+ *  - FIRST_TOUCH - a single copy of the weights residing on the NUMA node of the stream that created it
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_NUMA_POLICY);
+DECLARE_CONFIG_VALUE(REPLICATE);
+DECLARE_CONFIG_VALUE(INTERLEAVE);
+DECLARE_CONFIG_VALUE(FIRST_TOUCH);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
@@ -72,4 +102,40 @@ DECLARE_CONFIG_KEY(CONFIG_DEVICE_ID);
 
 }  // namespace PluginConfigInternalParams
 
+namespace Metrics {
+
+/**
+ * @brief Metric to get hits, misses and evictions counters of the CPU runtime parameters cache of an executable
+ * network. Returned as std::map<std::string, uint64_t> with "HITS", "MISSES" and "EVICTIONS" keys
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_RUNTIME_CACHE_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the number of the inputs/outputs of the CPU infer requests that were bound to the graph memory
+ * directly (zero-copy) versus the copied ones, accumulated over all inferences of an executable network. Returned as
+ * std::map<std::string, uint64_t> with "INPUTS_ZERO_COPY", "INPUTS_COPIED", "OUTPUTS_ZERO_COPY" and "OUTPUTS_COPIED" keys
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_ZERO_COPY_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the number of bytes of the cached CPU weights residing on each NUMA node, for all the
+ * executable networks sharing the CPU_WEIGHTS_NUMA_POLICY of the network. Returned as std::map<std::string, uint64_t>
+ * with "NODE_<id>" keys and the "UNKNOWN" key for the memory which placement can't be determined
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_WEIGHTS_NUMA_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the state of the adaptive batch collection timeout of the auto-batching executable network
+ * (enabled with the AUTO_BATCH_LATENCY_TARGET). Returned as std::map<std::string, uint64_t> with the "TIMEOUT",
+ * "REQUESTS_INTERVAL", "BATCH_EXECUTION_TIME" and "BATCH1_EXECUTION_TIME" keys (in microseconds) and the
+ * "PARTIAL_BATCHES" and "BATCH1_FALLBACKS" counters
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(AUTO_BATCH_ADAPTIVE_TIMEOUT_STATISTICS, std::map<std::string, uint64_t>);
+
+}  // namespace Metrics
+
 }  // namespace InferenceEngine
@@ -50,6 +50,20 @@ public:
      */
     virtual Blob::CPtr GetState() const;
 
+    /**
+     * @brief Detaches the blob holding the current state from the infer request without copying.
+     * The infer request can't be used until a state is attached back
+     * @return The blob holding the current state
+     */
+    virtual Blob::Ptr Detach();
+
+    /**
+     * @brief Attaches the blob as the current state without copying its data.
+     * The state may keep using the blob memory until it is destroyed, Detach may return another blob
+     * @param newState A blob holding the state, e.g. the one returned by Detach
+     */
+    virtual void Attach(const Blob::Ptr& newState);
+
 protected:
     /**
      * @brief A default dtor
@@ -103,6 +103,8 @@ public:
                          // (for large #streams)
         } _threadPreferredCoreType =
             PreferredCoreType::ANY;  //!< In case of @ref HYBRID_AWARE hints the TBB to affinitize
+        bool _workStealing = false;  //!< When the stream is the only busy one on its NUMA node (and no tasks are
+                                     //!< queued) its `ie_parallel` calls may use the threads of the idle streams
 
         /**
          * @brief      A constructor with arguments
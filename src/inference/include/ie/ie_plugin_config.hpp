@@ -293,6 +293,13 @@ DECLARE_CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG);
  * @brief Auto-batching configuration: string with timeout (in ms), e.g. "100"
  */
 DECLARE_CONFIG_KEY(AUTO_BATCH_TIMEOUT);
+/**
+ * @brief Auto-batching configuration: string with the target latency of the requests (in ms), e.g. "50".
+ * When set to non-zero value, the timeout to collect the batch is adjusted on the fly (from the requests arrival rate
+ * and the execution times), so the AUTO_BATCH_TIMEOUT is used only as the upper bound. The smaller batch sizes are
+ * then also compiled to execute the partially collected batches. Default is "0" (disabled)
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET);
 
 /**
  * @brief Limit `#threads` that are used by Inference Engine for inference on the CPU.
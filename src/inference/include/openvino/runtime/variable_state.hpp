@@ -77,6 +77,26 @@ public:
      * @param state The current state to set.
      */
     void set_state(const Tensor& state);
+
+    /**
+     * @brief Detaches the tensor holding the current state from the infer request without copying.
+     * The infer request can't be inferred until a state is attached with attach_state.
+     * @return A tensor representing a state.
+     */
+    Tensor detach_state();
+
+    /**
+     * @brief Attaches the tensor as the state for the next inference without copying its data.
+     * Together with detach_state it allows a few infer requests to serve many sessions of a stateful model:
+     * the states of the sessions are kept in the tensors and are exchanged in O(1).
+     * The infer request takes the ownership of the tensor memory until the request is destroyed: the state is
+     * double-buffered, so the memory keeps being written by the inferences after the state is detached, and
+     * detach_state may return another tensor. The tensor must not be accessed after it is attached, the sessions
+     * keep the tensors returned by detach_state instead.
+     * @param state The tensor with the element type and the shape of the state, e.g. the one returned by
+     * detach_state.
+     */
+    void attach_state(const Tensor& state);
 };
 
 }  // namespace ov
@@ -87,4 +87,12 @@ void VariableState::set_state(const Tensor& state) {
     OV_VARIABLE_CALL_STATEMENT(_impl->SetState(state._impl));
 }
 
+Tensor VariableState::detach_state() {
+    OV_VARIABLE_CALL_STATEMENT(return {_impl->Detach(), _so});
+}
+
+void VariableState::attach_state(const Tensor& state) {
+    OV_VARIABLE_CALL_STATEMENT(_impl->Attach(state._impl));
+}
+
 }  // namespace ov
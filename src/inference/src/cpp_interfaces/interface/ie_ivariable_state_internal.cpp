@@ -23,4 +23,12 @@ Blob::CPtr IVariableStateInternal::GetState() const {
     return state;
 }
 
+Blob::Ptr IVariableStateInternal::Detach() {
+    IE_THROW(NotImplemented);
+}
+
+void IVariableStateInternal::Attach(const Blob::Ptr&) {
+    IE_THROW(NotImplemented);
+}
+
 }  // namespace InferenceEngine
@@ -27,12 +27,14 @@
 #include "ie_itt.hpp"
 #include "ie_network_reader.hpp"
 #include "ie_ngraph_utils.hpp"
+#include "ie_parallel.hpp"
 #include "ie_plugin_config.hpp"
 #include "ie_remote_context.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/opsets/opset.hpp"
 #include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/op/parameter.hpp"
 #include "openvino/op/result.hpp"
@@ -119,6 +121,20 @@ void allowNotImplemented(F&& f) {
     }
 }
 
+// The reference kernels (i.e. the constant folding of the large constants) are split by the runtime threading
+void setReferenceParallelFor() {
+    static std::once_flag flag;
+    std::call_once(flag, [] {
+        ngraph::runtime::reference::set_parallel_for_impl(
+            [](size_t nchunks, const std::function<void(size_t)>& body) {
+                ie::parallel_for(nchunks, body);
+            },
+            [] {
+                return static_cast<size_t>(parallel_get_max_threads());
+            });
+    });
+}
+
 ov::AnyMap flatten_sub_properties(const std::string& device, const ov::AnyMap& properties) {
     ov::AnyMap result = properties;
     for (auto&& property : properties) {
@@ -381,6 +397,7 @@ public:
         opsetNames.insert("opset6");
         opsetNames.insert("opset7");
         opsetNames.insert("opset8");
+        setReferenceParallelFor();
     }
 
     ~CoreImpl() override = default;
@@ -8,6 +8,7 @@
 #include <cassert>
 #include <climits>
 #include <condition_variable>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <openvino/itt.hpp>
@@ -67,11 +68,7 @@ struct CPUStreamsExecutor::Impl {
                     _impl->_streamIdQueue.pop();
                 }
             }
-            _numaNodeId = _impl->_config._streams
-                              ? _impl->_usedNumaNodes.at((_streamId % _impl->_config._streams) /
-                                                         ((_impl->_config._streams + _impl->_usedNumaNodes.size() - 1) /
-                                                          _impl->_usedNumaNodes.size()))
-                              : _impl->_usedNumaNodes.at(_streamId % _impl->_usedNumaNodes.size());
+            _numaNodeId = _impl->GetNumaNodeId(_streamId);
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
             const auto concurrency = (0 == _impl->_config._threadsPerStream) ? custom::task_arena::automatic
                                                                              : _impl->_config._threadsPerStream;
@@ -194,6 +191,49 @@ struct CPUStreamsExecutor::Impl {
             _usedNumaNodes = numaNodes;
         }
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+        // the hybrid-aware streams are bound to the specific core types, so the threads are not lent between them
+        // (also, with the default #threads per stream every stream arena spans all the cores already)
+        if (_config._workStealing && (0 != _config._threadsPerStream) &&
+            (ThreadBindingType::HYBRID_AWARE != _config._threadBindingType)) {
+            for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+                auto& state = _numaNodes[GetNumaNodeId(streamId)];
+                if (0 == state._streams++) {
+                    state._firstStreamId = streamId;
+                }
+            }
+            for (auto& node : _numaNodes) {
+                auto& state = node.second;
+                if (state._streams < 2) {
+                    continue;
+                }
+                // the arena is as wide as all the streams of the node together; the TBB market distributes the
+                // worker threads between the arenas, so the threads join it only while other streams are idle
+                const auto concurrency = _config._threadsPerStream * state._streams;
+                if (ThreadBindingType::NUMA == _config._threadBindingType) {
+                    state._stealingArena.reset(
+                        new custom::task_arena{custom::task_arena::constraints{node.first, concurrency}});
+                } else {
+                    state._stealingArena.reset(new custom::task_arena{concurrency});
+                    if (ThreadBindingType::CORES == _config._threadBindingType) {
+                        // the threads of the shared arena are pinned to the cores of the node's streams
+                        // (the streams of the node have consecutive ids)
+                        CpuSet processMask;
+                        int ncpus = 0;
+                        std::tie(processMask, ncpus) = GetProcessMask();
+                        if (nullptr != processMask) {
+                            state._observer.reset(new Stream::Observer{*state._stealingArena,
+                                                                       std::move(processMask),
+                                                                       ncpus,
+                                                                       state._firstStreamId,
+                                                                       _config._threadsPerStream,
+                                                                       _config._threadBindingStep,
+                                                                       _config._threadBindingOffset});
+                            state._observer->observe(true);
+                        }
+                    }
+                }
+            }
+        }
         if (ThreadBindingType::HYBRID_AWARE == config._threadBindingType) {
             const auto core_types = custom::info::core_types();
             const int threadsPerStream =
@@ -220,6 +260,7 @@ struct CPUStreamsExecutor::Impl {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
                 for (bool stopped = false; !stopped;) {
                     Task task;
+                    bool queueIsEmpty = false;
                     {
                         std::unique_lock<std::mutex> lock(_mutex);
                         _queueCondVar.wait(lock, [&] {
@@ -228,10 +269,19 @@ struct CPUStreamsExecutor::Impl {
                         if (!_taskQueue.empty()) {
                             task = std::move(_taskQueue.front());
                             _taskQueue.pop();
+                            queueIsEmpty = _taskQueue.empty();
                         }
                     }
                     if (task) {
-                        Execute(task, *(_streams.local()));
+                        auto& stream = *(_streams.local());
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+                        auto node = _numaNodes.find(stream._numaNodeId);
+                        if (node != _numaNodes.end() && nullptr != node->second._stealingArena) {
+                            ExecuteWithStealing(task, stream, node->second, queueIsEmpty);
+                            continue;
+                        }
+#endif
+                        Execute(task, stream);
                     }
                 }
             });
@@ -259,6 +309,35 @@ struct CPUStreamsExecutor::Impl {
 #endif
     }
 
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    struct NumaNodeState;
+    void ExecuteWithStealing(const Task& task, Stream& stream, NumaNodeState& node, const bool queueIsEmpty) {
+        // the stream isolation is kept in the steady state: the shared arena is taken only by the single busy
+        // stream of the node, when there is no other work to pick up by the idle streams anyway
+        struct BusyStreamGuard {
+            explicit BusyStreamGuard(std::atomic<int>& busyStreams) : _busyStreams(busyStreams) {}
+            ~BusyStreamGuard() {
+                --_busyStreams;
+            }
+            std::atomic<int>& _busyStreams;
+        };
+        const auto busyStreams = ++node._busyStreams;
+        BusyStreamGuard guard{node._busyStreams};
+        if (queueIsEmpty && (1 == busyStreams)) {
+            node._stealingArena->execute(task);
+        } else {
+            Execute(task, stream);
+        }
+    }
+#endif
+
+    int GetNumaNodeId(const int streamId) const {
+        return _config._streams ? _usedNumaNodes.at((streamId % _config._streams) /
+                                                    ((_config._streams + _usedNumaNodes.size() - 1) /
+                                                     _usedNumaNodes.size()))
+                                : _usedNumaNodes.at(streamId % _usedNumaNodes.size());
+    }
+
     void Defer(Task task) {
         auto& stream = *(_streams.local());
         stream._taskQueue.push(std::move(task));
@@ -293,6 +372,20 @@ struct CPUStreamsExecutor::Impl {
     // (so mapping is actually just an upper_bound: core type is deduced from the entry for which the id < #streams)
     using StreamIdToCoreTypes = std::vector<std::pair<custom::core_type_id, int>>;
     StreamIdToCoreTypes total_streams_on_core_types;
+    // per NUMA node state of the work stealing mode (populated only when the Config::_workStealing is set)
+    struct NumaNodeState {
+        ~NumaNodeState() {
+            if (nullptr != _observer) {
+                _observer->observe(false);
+            }
+        }
+        int _streams = 0;
+        int _firstStreamId = 0;
+        std::atomic<int> _busyStreams{0};
+        std::unique_ptr<custom::task_arena> _stealingArena;
+        std::unique_ptr<Stream::Observer> _observer;
+    };
+    std::map<int, NumaNodeState> _numaNodes;
 #endif
 };
 
@@ -27,7 +27,9 @@
 namespace AutoBatchPlugin {
 using namespace InferenceEngine;
 
-std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG), CONFIG_KEY(AUTO_BATCH_TIMEOUT)};
+std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG),
+                                                 CONFIG_KEY(AUTO_BATCH_TIMEOUT),
+                                                 CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET)};
 
 template <Precision::ePrecision precision>
 Blob::Ptr create_shared_blob_on_top_of_batched_blob(Blob::Ptr batched_blob,
@@ -330,16 +332,24 @@ void AutoBatchInferRequest::SetBlobsToAnotherRequest(SoIInferRequestInternal& re
 }
 
 void AutoBatchInferRequest::CopyInputsIfNeeded() {
+    const bool partial = _wasBatchedRequestUsed == eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+    auto& batchedRequest = partial ? _partialBatchRequest : _myBatchedRequestWrapper._inferRequestBatched;
     for (const auto& it : _networkInputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(GetBlob(name), _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), true);
+        CopyBlobIfNeeded(GetBlob(name),
+                         batchedRequest->GetBlob(name),
+                         true,
+                         partial ? _partialBatchId : _batchId,
+                         partial ? _partialBatchSize : _batchSize);
     }
 }
 
 void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
                                              InferenceEngine::Blob::Ptr dst,
-                                             bool bInput) {
+                                             bool bInput,
+                                             size_t batchId,
+                                             size_t batchSize) {
     auto bufferDst = dst->buffer();
     auto ptrDst = bufferDst.as<char*>();
     auto bufferSrc = src->cbuffer();
@@ -347,13 +357,13 @@ void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
     ptrdiff_t szDst = dst->byteSize();
     ptrdiff_t szSrc = src->byteSize();
     if (bInput) {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szDst / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szDst / batchSize : 0;
         if ((ptrDst + offset) == ptrSrc)
             return;
         else
             memcpy(ptrDst + offset, ptrSrc, szSrc);
     } else {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szSrc / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szSrc / batchSize : 0;
         if ((ptrSrc + offset) == ptrDst)
             return;
         else
@@ -362,10 +372,16 @@ void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
 }
 
 void AutoBatchInferRequest::CopyOutputsIfNeeded() {
+    const bool partial = _wasBatchedRequestUsed == eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+    auto& batchedRequest = partial ? _partialBatchRequest : _myBatchedRequestWrapper._inferRequestBatched;
     for (const auto& it : _networkOutputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), GetBlob(name), false);
+        CopyBlobIfNeeded(batchedRequest->GetBlob(name),
+                         GetBlob(name),
+                         false,
+                         partial ? _partialBatchId : _batchId,
+                         partial ? _partialBatchSize : _batchSize);
     }
 }
 
@@ -384,11 +400,25 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
             std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
             t.first = _this;
             t.second = std::move(task);
-            workerInferRequest._tasks.push(t);
-            // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
-            const int sz = workerInferRequest._tasks.size();
-            if (sz == workerInferRequest._batchSize) {
-                workerInferRequest._cond.notify_one();
+            if (workerInferRequest._adaptiveTimeout) {
+                int sz;
+                {
+                    // the worker pops the tasks under the same mutex, so the arrival times follow the queue
+                    std::lock_guard<std::mutex> lock(workerInferRequest._mutex);
+                    workerInferRequest._tasks.push(t);
+                    sz = workerInferRequest._tasks.size();
+                    workerInferRequest._adaptiveTimeout->OnRequestArrived();
+                }
+                // the first request starts the countdown of the (adaptive) timeout, so the worker is notified as well
+                if (sz == 1 || sz == workerInferRequest._batchSize)
+                    workerInferRequest._cond.notify_one();
+            } else {
+                workerInferRequest._tasks.push(t);
+                // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
+                const int sz = workerInferRequest._tasks.size();
+                if (sz == workerInferRequest._batchSize) {
+                    workerInferRequest._cond.notify_one();
+                }
             }
         };
         AutoBatchAsyncInferRequest* _this = nullptr;
@@ -401,7 +431,9 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
                           std::rethrow_exception(batchReq._exceptionPtr);
                       // in the case of non-batched execution the blobs were set explicitly
                       if (AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED ==
-                          this->_inferRequest->_wasBatchedRequestUsed)
+                              this->_inferRequest->_wasBatchedRequestUsed ||
+                          AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED ==
+                              this->_inferRequest->_wasBatchedRequestUsed)
                           this->_inferRequest->CopyOutputsIfNeeded();
                   }}};
 }
@@ -411,6 +443,8 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> AutoBatchAsyn
     CheckState();
     if (AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
         return _inferRequest->_myBatchedRequestWrapper._inferRequestBatched->GetPerformanceCounts();
+    else if (AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
+        return _inferRequest->_partialBatchRequest->GetPerformanceCounts();
     else
         return _inferRequestWithoutBatch->GetPerformanceCounts();
 }
@@ -423,6 +457,80 @@ AutoBatchAsyncInferRequest::~AutoBatchAsyncInferRequest() {
     StopAndWait();
 }
 
+// ------------------------------AdaptiveBatchTimeout----------------------------
+AdaptiveBatchTimeout::AdaptiveBatchTimeout(unsigned int latencyTarget, int batchSize)
+    : _latencyTarget(latencyTarget * 1000.0),
+      _batchSize(batchSize) {}
+
+void AdaptiveBatchTimeout::Update(double& average, double value) {
+    // exponential moving average, the very first measurement is taken as is
+    average = average < 0 ? value : average + 0.2 * (value - average);
+}
+
+void AdaptiveBatchTimeout::OnRequestArrived(Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_lastArrival != Clock::time_point()) {
+        const double interval = std::chrono::duration<double, std::micro>(now - _lastArrival).count();
+        // the idle periods should not dominate the estimation, so the interval is capped
+        Update(_requestsInterval, std::min(interval, _latencyTarget));
+    }
+    _lastArrival = now;
+    _queuedArrivals.push_back(now);
+}
+
+void AdaptiveBatchTimeout::OnRequestsPopped(int num) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    IE_ASSERT(num <= static_cast<int>(_queuedArrivals.size()));
+    _queuedArrivals.erase(_queuedArrivals.begin(), _queuedArrivals.begin() + num);
+}
+
+void AdaptiveBatchTimeout::OnBatchExecuted(Clock::duration time, int batchSize, int numRequests) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    // only the full batch size is relevant for the estimation of the timeout
+    if (batchSize == _batchSize)
+        Update(_batchExecTime, std::chrono::duration<double, std::micro>(time).count());
+    if (numRequests < _batchSize)
+        _partialBatches++;
+}
+
+void AdaptiveBatchTimeout::OnBatch1Executed(Clock::duration time, int numRequests) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    Update(_batch1ExecTime, std::chrono::duration<double, std::micro>(time).count() / std::max(numRequests, 1));
+    _batch1Fallbacks++;
+}
+
+AdaptiveBatchTimeout::Clock::duration AdaptiveBatchTimeout::GetTimeout(Clock::duration idle, Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_queuedArrivals.empty())
+        return idle;
+    const int queued = _queuedArrivals.size();
+    // the time that the first request can spend waiting for the rest of the batch, while still meeting the target
+    // (until the batched execution time is measured, it is assumed to take half of the target)
+    const double execTime = _batchExecTime < 0 ? _latencyTarget / 2 : _batchExecTime;
+    double window = std::max(0.0, _latencyTarget - execTime);
+    // waiting is pointless if (with the current arrival rate) the batch cannot be collected in time anyway
+    if (_requestsInterval >= 0 && (_batchSize - queued) * _requestsInterval > window)
+        window = 0.0;
+    _timeout = window;
+    const double waited = std::chrono::duration<double, std::micro>(now - _queuedArrivals.front()).count();
+    const auto left = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double, std::micro>(std::max(0.0, window - waited)));
+    return std::min(left, idle);
+}
+
+std::map<std::string, uint64_t> AdaptiveBatchTimeout::GetStatistics() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto toUint = [](double v) {
+        return static_cast<uint64_t>(std::max(0.0, v));
+    };
+    return {{"TIMEOUT", toUint(_timeout)},
+            {"REQUESTS_INTERVAL", toUint(_requestsInterval)},
+            {"BATCH_EXECUTION_TIME", toUint(_batchExecTime)},
+            {"BATCH1_EXECUTION_TIME", toUint(_batch1ExecTime)},
+            {"PARTIAL_BATCHES", _partialBatches},
+            {"BATCH1_FALLBACKS", _batch1Fallbacks}};
+}
+
 // ------------------------------AutoBatchExecutableNetwork----------------------------
 AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     const InferenceEngine::SoExecutableNetworkInternal& networkWithBatch,
@@ -430,11 +538,13 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     const DeviceInformation& networkDevice,
     const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
     const std::set<std::string>& batchedInputs,
-    const std::set<std::string>& batchedOutputs)
+    const std::set<std::string>& batchedOutputs,
+    const std::map<int, InferenceEngine::SoExecutableNetworkInternal>& networksWithPartialBatch)
     : InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr,
                                                           std::make_shared<InferenceEngine::ImmediateExecutor>()),
       _network{networkWithBatch},
       _networkWithoutBatch{networkWithoutBatch},
+      _networksWithPartialBatch{networksWithPartialBatch},
       _config{config},
       _batchedInputs(batchedInputs),
       _batchedOutputs(batchedOutputs) {
@@ -443,6 +553,9 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     auto time_out = config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
     IE_ASSERT(time_out != config.end());
     _timeOut = ParseTimeoutValue(time_out->second.as<std::string>());
+    auto latency_target = config.find(CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET));
+    if (latency_target != config.end())
+        _latencyTarget = ParseTimeoutValue(latency_target->second.as<std::string>());
 }
 
 AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
@@ -456,7 +569,8 @@ AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
 unsigned int AutoBatchExecutableNetwork::ParseTimeoutValue(const std::string& s) {
     auto val = std::stoi(s);
     if (val < 0)
-        IE_THROW(ParameterMismatch) << "Value for the " << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " should be unsigned int";
+        IE_THROW(ParameterMismatch) << "Value for the " << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " or "
+                                    << CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET) << " should be unsigned int";
     return val;
 }
 
@@ -505,10 +619,21 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
         workerRequestPtr->_inferRequestBatched = {_network->CreateInferRequest(), _network._so};
         workerRequestPtr->_batchSize = _device.batchForDevice;
         workerRequestPtr->_completionTasks.resize(workerRequestPtr->_batchSize);
+        for (const auto& partial : _networksWithPartialBatch)
+            workerRequestPtr->_inferRequestsWithPartialBatch[partial.first] = {partial.second->CreateInferRequest(),
+                                                                               partial.second._so};
+        if (_latencyTarget)
+            workerRequestPtr->_adaptiveTimeout.reset(
+                new AdaptiveBatchTimeout(_latencyTarget, workerRequestPtr->_batchSize));
         workerRequestPtr->_inferRequestBatched->SetCallback(
             [workerRequestPtr, this](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exceptionPtr = exceptionPtr;
+                if (workerRequestPtr->_adaptiveTimeout)
+                    workerRequestPtr->_adaptiveTimeout->OnBatchExecuted(
+                        AdaptiveBatchTimeout::Clock::now() - workerRequestPtr->_batchStartTime,
+                        workerRequestPtr->_batchSize,
+                        workerRequestPtr->_batchSize);
                 IE_ASSERT(workerRequestPtr->_completionTasks.size() == (size_t)workerRequestPtr->_batchSize);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batchSize; c++) {
@@ -519,11 +644,85 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
             });
 
         workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
+            using QueuedTasks = std::vector<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>>;
+            // pops the `num` collected tasks under the mutex, so the adaptive timeout drops their arrival times
+            // consistently with the requests submitted in parallel
+            auto popTasks = [workerRequestPtr](int num) {
+                QueuedTasks tasks(num);
+                std::lock_guard<std::mutex> lock(workerRequestPtr->_mutex);
+                for (auto& t : tasks)
+                    IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                if (workerRequestPtr->_adaptiveTimeout)
+                    workerRequestPtr->_adaptiveTimeout->OnRequestsPopped(num);
+                return tasks;
+            };
+            // executes the popped tasks with the request of the (smaller) `batch`, the slots beyond the number of
+            // the tasks are just padding. The outputs are copied back by the requests themselves
+            auto executePartialBatch = [workerRequestPtr](QueuedTasks tasks,
+                                                          int batch,
+                                                          SoIInferRequestInternal& partialRequest) {
+                const int num = tasks.size();
+                for (int n = 0; n < num; n++) {
+                    auto& req = tasks[n].first->_inferRequest;
+                    req->_wasBatchedRequestUsed = AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+                    req->_partialBatchRequest = partialRequest;
+                    req->_partialBatchId = n;
+                    req->_partialBatchSize = batch;
+                    req->CopyInputsIfNeeded();
+                }
+                std::promise<void> all_completed;
+                auto all_completed_future = all_completed.get_future();
+                partialRequest->SetCallback([&tasks, &all_completed](std::exception_ptr p) {
+                    for (auto& t : tasks) {
+                        if (p)
+                            t.first->_inferRequest->_exceptionPtr = p;
+                        t.second();
+                    }
+                    all_completed.set_value();
+                });
+                const auto start = AdaptiveBatchTimeout::Clock::now();
+                partialRequest->StartAsync();
+                all_completed_future.get();
+                if (workerRequestPtr->_adaptiveTimeout)
+                    workerRequestPtr->_adaptiveTimeout->OnBatchExecuted(AdaptiveBatchTimeout::Clock::now() - start,
+                                                                        batch,
+                                                                        num);
+            };
+            // executes each of the popped tasks with batch1
+            auto executeBatch1 = [workerRequestPtr](QueuedTasks tasks) {
+                const int num = tasks.size();
+                std::atomic<int> arrived = {0};
+                std::promise<void> all_completed;
+                auto all_completed_future = all_completed.get_future();
+                const auto start = AdaptiveBatchTimeout::Clock::now();
+                for (auto& t : tasks) {
+                    t.first->_inferRequestWithoutBatch->SetCallback(
+                        [t, num, &arrived, &all_completed](std::exception_ptr p) {
+                            if (p)
+                                t.first->_inferRequest->_exceptionPtr = p;
+                            t.second();
+                            if (num == ++arrived)
+                                all_completed.set_value();
+                        });
+                    t.first->_inferRequest->_wasBatchedRequestUsed =
+                        AutoBatchInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
+                    t.first->_inferRequest->SetBlobsToAnotherRequest(t.first->_inferRequestWithoutBatch);
+                    t.first->_inferRequestWithoutBatch->StartAsync();
+                }
+                all_completed_future.get();
+                if (workerRequestPtr->_adaptiveTimeout)
+                    workerRequestPtr->_adaptiveTimeout->OnBatch1Executed(AdaptiveBatchTimeout::Clock::now() - start,
+                                                                         num);
+            };
             while (1) {
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(_timeOut));
+                    auto timeout = std::chrono::duration_cast<AdaptiveBatchTimeout::Clock::duration>(
+                        std::chrono::milliseconds(_timeOut));
+                    if (workerRequestPtr->_adaptiveTimeout)
+                        timeout = workerRequestPtr->_adaptiveTimeout->GetTimeout(timeout);
+                    status = workerRequestPtr->_cond.wait_for(lock, timeout);
                 }
                 if (_terminate) {
                     break;
@@ -532,38 +731,37 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                     // it is ok to call size() (as the _tasks can only grow in parallel)
                     const int sz = workerRequestPtr->_tasks.size();
                     if (sz == workerRequestPtr->_batchSize) {
-                        std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
+                        auto tasks = popTasks(sz);
                         for (int n = 0; n < sz; n++) {
-                            IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                            auto& t = tasks[n];
                             workerRequestPtr->_completionTasks[n] = std::move(t.second);
                             t.first->_inferRequest->CopyInputsIfNeeded();
                             t.first->_inferRequest->_wasBatchedRequestUsed =
                                 AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        workerRequestPtr->_batchStartTime = AdaptiveBatchTimeout::Clock::now();
                         workerRequestPtr->_inferRequestBatched->StartAsync();
                     } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
-                        std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
-                        std::atomic<int> arrived = {0};
-                        std::promise<void> all_completed;
-                        auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
-                            IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
-                            t.first->_inferRequestWithoutBatch->SetCallback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
-                                    if (p)
-                                        t.first->_inferRequest->_exceptionPtr = p;
-                                    t.second();
-                                    if (sz == ++arrived)
-                                        all_completed.set_value();
-                                });
-                            t.first->_inferRequest->_wasBatchedRequestUsed =
-                                AutoBatchInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
-                            t.first->_inferRequest->SetBlobsToAnotherRequest(t.first->_inferRequestWithoutBatch);
-                            t.first->_inferRequestWithoutBatch->StartAsync();
+                        // timeout to collect the batch is over, the collected requests are executed with the smallest
+                        // pre-compiled batch that fits (or in chunks of the largest one), which is still cheaper than
+                        // executing them one by one. Notice that the (full) batched request cannot be used with
+                        // padding, as the outputs of the requests that are not in the batch would be overwritten
+                        auto& partials = workerRequestPtr->_inferRequestsWithPartialBatch;
+                        auto tasks = popTasks(sz);
+                        auto next = tasks.begin();
+                        int left = sz;
+                        while (left > 1 && !partials.empty()) {
+                            auto partial = partials.lower_bound(left);
+                            if (partial == partials.end())
+                                partial = std::prev(partials.end());
+                            const int num = std::min(left, partial->first);
+                            executePartialBatch({next, next + num}, partial->first, partial->second);
+                            next += num;
+                            left -= num;
                         }
-                        all_completed_future.get();
+                        // the last request (or all, if no smaller batch is available) is executed with batch1
+                        if (left)
+                            executeBatch1({next, tasks.end()});
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
                 }
@@ -639,12 +837,30 @@ InferenceEngine::Parameter AutoBatchExecutableNetwork::GetMetric(const std::stri
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, reqs);
     } else if (name == METRIC_KEY(NETWORK_NAME)) {
         IE_SET_METRIC_RETURN(NETWORK_NAME, _networkWithoutBatch->GetMetric(METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(AUTO_BATCH_ADAPTIVE_TIMEOUT_STATISTICS)) {
+        if (!_latencyTarget)
+            IE_THROW() << "The " << name << " metric requires the " << CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET)
+                       << " to be set";
+        // the times are averaged over the workers, while the counters are summed up
+        std::map<std::string, uint64_t> stats;
+        std::lock_guard<std::mutex> lock(_workerRequestsMutex);
+        for (const auto& w : _workerRequests) {
+            for (const auto& s : w->_adaptiveTimeout->GetStatistics())
+                stats[s.first] += s.second;
+        }
+        if (!_workerRequests.empty()) {
+            for (const auto& key : {"TIMEOUT", "REQUESTS_INTERVAL", "BATCH_EXECUTION_TIME", "BATCH1_EXECUTION_TIME"})
+                stats[key] /= _workerRequests.size();
+        }
+        IE_SET_METRIC_RETURN(AUTO_BATCH_ADAPTIVE_TIMEOUT_STATISTICS, stats);
     } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
-        IE_SET_METRIC_RETURN(SUPPORTED_METRICS,
-                             {METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
-                              METRIC_KEY(SUPPORTED_METRICS),
-                              METRIC_KEY(NETWORK_NAME),
-                              METRIC_KEY(SUPPORTED_CONFIG_KEYS)});
+        std::vector<std::string> metrics = {METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+                                            METRIC_KEY(SUPPORTED_METRICS),
+                                            METRIC_KEY(NETWORK_NAME),
+                                            METRIC_KEY(SUPPORTED_CONFIG_KEYS)};
+        if (_latencyTarget)
+            metrics.push_back(METRIC_KEY(AUTO_BATCH_ADAPTIVE_TIMEOUT_STATISTICS));
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS,
                              {CONFIG_KEY(AUTO_BATCH_TIMEOUT)});  // only timeout can be changed on the fly
@@ -753,14 +969,13 @@ void AutoBatchInferencePlugin::CheckConfig(const std::map<std::string, std::stri
             IE_THROW() << "Unsupported config key: " << name;
         if (name == CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG)) {
             ParseBatchDevice(val);
-        } else if (name == CONFIG_KEY(AUTO_BATCH_TIMEOUT)) {
+        } else if (name == CONFIG_KEY(AUTO_BATCH_TIMEOUT) || name == CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET)) {
             try {
                 auto t = std::stoi(val);
                 if (t < 0)
                     IE_THROW(ParameterMismatch);
             } catch (const std::exception& e) {
-                IE_THROW(ParameterMismatch)
-                    << " Expecting unsigned int value for " << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " got " << val;
+                IE_THROW(ParameterMismatch) << " Expecting unsigned int value for " << name << " got " << val;
             }
         }
     }
@@ -779,6 +994,7 @@ IE_DEFINE_PLUGIN_CREATE_FUNCTION(AutoBatchInferencePlugin, version)
 AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
     _pluginName = "BATCH";
     _config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = "1000";  // default value, in ms
+    _config[CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET)] = "0";  // adaptive timeout is disabled by default
 }
 
 InferenceEngine::Parameter AutoBatchInferencePlugin::GetMetric(
@@ -827,6 +1043,8 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
 
     std::set<std::string> batched_inputs;
     std::set<std::string> batched_outputs;
+    // the copy of the network the batch is found in, it is then reshaped to every batch size to be compiled
+    CNNNetwork clonedNetwork;
     // check that the auto-batching is applicable in general
     try {
         // if applicable, the Auto-Batching is implicitly enabled via the performance hints
@@ -836,7 +1054,7 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
         const bool bTputInLoadCfg = (mode != deviceConfig.end() && mode->second == tput);
         // if the auto-batching is enabled implicitly, check the dims carefully, to avoid outstanding failures
         const bool check_dims = (bTputInPlg || bTputInLoadCfg);
-        CNNNetwork clonedNetwork(InferenceEngine::details::cloneNetwork(network));
+        clonedNetwork = InferenceEngine::details::cloneNetwork(network);
         auto function = clonedNetwork.getFunction();
         // find the batch dim
         ov::pass::Manager m;
@@ -948,27 +1166,46 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
             networkConfig.insert(c);
     }
 
+    // the devices compile their own copies of the network, so a single copy is reshaped for all the batch sizes
+    // instead of cloning the whole network for each of them
+    auto loadNetworkWithBatch = [&](int batch) {
+        ICNNNetwork::InputShapes shapes = clonedNetwork.getInputShapes();
+        for (const auto& input : batched_inputs)
+            shapes[input][0] = batch;
+        clonedNetwork.reshape(shapes);
+        return ctx ? core->LoadNetwork(clonedNetwork, ctx, deviceConfigNoAutoBatch)
+                   : core->LoadNetwork(clonedNetwork, deviceName, deviceConfigNoAutoBatch);
+    };
     InferenceEngine::SoExecutableNetworkInternal executableNetworkWithBatch;
     if (metaDevice.batchForDevice > 1 && batched_inputs.size()) {
         try {
-            CNNNetwork reshaped(InferenceEngine::details::cloneNetwork(network));
-            ICNNNetwork::InputShapes shapes = reshaped.getInputShapes();
-            for (const auto& input : batched_inputs)
-                shapes[input][0] = metaDevice.batchForDevice;
-            reshaped.reshape(shapes);
-            executableNetworkWithBatch = ctx ? core->LoadNetwork(reshaped, ctx, deviceConfigNoAutoBatch)
-                                             : core->LoadNetwork(reshaped, deviceName, deviceConfigNoAutoBatch);
+            executableNetworkWithBatch = loadNetworkWithBatch(metaDevice.batchForDevice);
         } catch (...) {
             metaDevice.batchForDevice = 1;
         }
     }
+    // the smaller (power of 2) batch sizes to execute the partially collected batches. These are compiled only with
+    // the adaptive timeout, as otherwise the (rare) timeouts do not justify the extra compilation time and memory
+    std::map<int, InferenceEngine::SoExecutableNetworkInternal> executableNetworksWithPartialBatch;
+    const auto latency_target = fullConfig.find(CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET));
+    const bool adaptive_timeout = latency_target != fullConfig.end() && std::stoi(latency_target->second) > 0;
+    if (executableNetworkWithBatch && adaptive_timeout) {
+        for (int batch = 2; batch < metaDevice.batchForDevice; batch *= 2) {
+            try {
+                executableNetworksWithPartialBatch[batch] = loadNetworkWithBatch(batch);
+            } catch (...) {
+                // the partial batch is then padded to the next available batch size
+            }
+        }
+    }
 
     return std::make_shared<AutoBatchExecutableNetwork>(executableNetworkWithBatch,
                                                         executableNetworkWithoutBatch,
                                                         metaDevice,
                                                         networkConfig,
                                                         batched_inputs,
-                                                        batched_outputs);
+                                                        batched_outputs,
+                                                        executableNetworksWithPartialBatch);
 }
 
 InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadExeNetworkImpl(
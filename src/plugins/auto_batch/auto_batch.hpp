@@ -6,7 +6,11 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
@@ -29,6 +33,47 @@ struct DeviceInformation {
     int batchForDevice;
 };
 
+/**
+ * @brief Picks the timeout to collect the batch from the observed requests arrival rate and the execution times,
+ * so that the latency of the requests stays within the target
+ */
+class AdaptiveBatchTimeout {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Ptr = std::unique_ptr<AdaptiveBatchTimeout>;
+
+    AdaptiveBatchTimeout(unsigned int latencyTarget /*in ms*/, int batchSize);
+
+    // called on every request submission and when the worker pops the `num` requests from the queue. Both are called
+    // under the worker mutex (together with the queue update), so the arrival times are queued in the same order
+    void OnRequestArrived(Clock::time_point now = Clock::now());
+    void OnRequestsPopped(int num);
+    // execution time of the `numRequests` requests with the batched request of the `batchSize` (padded if larger)
+    void OnBatchExecuted(Clock::duration time, int batchSize, int numRequests);
+    // execution time of the `numRequests` requests in the batch1 mode
+    void OnBatch1Executed(Clock::duration time, int numRequests);
+
+    // time left to wait for the rest of the batch, the `idle` is returned when nothing is queued
+    Clock::duration GetTimeout(Clock::duration idle, Clock::time_point now = Clock::now());
+
+    std::map<std::string, uint64_t> GetStatistics() const;
+
+protected:
+    static void Update(double& average, double value);
+
+    const double _latencyTarget;  // all times are in microseconds
+    const int _batchSize;
+    mutable std::mutex _mutex;
+    double _requestsInterval = -1.0;  // the negative values mean "not measured yet"
+    double _batchExecTime = -1.0;
+    double _batch1ExecTime = -1.0;  // per request
+    double _timeout = 0.0;
+    Clock::time_point _lastArrival;
+    std::deque<Clock::time_point> _queuedArrivals;
+    uint64_t _partialBatches = 0;
+    uint64_t _batch1Fallbacks = 0;
+};
+
 class AutoBatchAsyncInferRequest;
 class AutoBatchExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
 public:
@@ -37,12 +82,17 @@ public:
         using Ptr = std::shared_ptr<WorkerInferRequest>;
         InferenceEngine::SoIInferRequestInternal _inferRequestBatched;
         int _batchSize;
+        // requests with the smaller (pre-compiled) batch sizes to execute the partially collected batch, by batch size
+        std::map<int, InferenceEngine::SoIInferRequestInternal> _inferRequestsWithPartialBatch;
         InferenceEngine::ThreadSafeQueueWithSize<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> _tasks;
         std::vector<InferenceEngine::Task> _completionTasks;
         std::thread _thread;
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr _exceptionPtr;
+        // not null only when the AUTO_BATCH_LATENCY_TARGET is set
+        AdaptiveBatchTimeout::Ptr _adaptiveTimeout;
+        AdaptiveBatchTimeout::Clock::time_point _batchStartTime;
     };
 
     explicit AutoBatchExecutableNetwork(
@@ -51,7 +101,8 @@ public:
         const DeviceInformation& networkDevices,
         const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
         const std::set<std::string>& batchedIntputs,
-        const std::set<std::string>& batchedOutputs);
+        const std::set<std::string>& batchedOutputs,
+        const std::map<int, InferenceEngine::SoExecutableNetworkInternal>& networksWithPartialBatch);
 
     void SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) override;
     InferenceEngine::Parameter GetConfig(const std::string& name) const override;
@@ -73,15 +124,17 @@ protected:
     DeviceInformation _device;
     InferenceEngine::SoExecutableNetworkInternal _network;
     InferenceEngine::SoExecutableNetworkInternal _networkWithoutBatch;
+    std::map<int, InferenceEngine::SoExecutableNetworkInternal> _networksWithPartialBatch;
 
     std::pair<WorkerInferRequest&, int> GetWorkerInferRequest();
     std::vector<WorkerInferRequest::Ptr> _workerRequests;
-    std::mutex _workerRequestsMutex;
+    mutable std::mutex _workerRequestsMutex;
 
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool _needPerfCounters = false;
     std::atomic_size_t _numRequestsCreated = {0};
     std::atomic_int _timeOut = {0};  // in ms
+    unsigned int _latencyTarget = 0;  // in ms, 0 disables the adaptive timeout
 
     const std::set<std::string> _batchedInputs;
     const std::set<std::string> _batchedOutputs;
@@ -114,11 +167,20 @@ public:
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
-        TIMEOUT_EXECUTED
+        TIMEOUT_EXECUTED,
+        PARTIAL_BATCH_EXECUTED
     } _wasBatchedRequestUsed = eExecutionFlavor::NOT_EXECUTED;
+    // valid for the PARTIAL_BATCH_EXECUTED only: the request with the smaller batch and the slot of this request in it
+    InferenceEngine::SoIInferRequestInternal _partialBatchRequest;
+    size_t _partialBatchId = 0;
+    size_t _partialBatchSize = 0;
 
 protected:
-    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src, InferenceEngine::Blob::Ptr dst, bool bInput);
+    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
+                          InferenceEngine::Blob::Ptr dst,
+                          bool bInput,
+                          size_t batchId,
+                          size_t batchSize);
     void ShareBlobsWithBatchRequest(const std::set<std::string>& batchedIntputs,
                                     const std::set<std::string>& batchedOutputs);
     size_t _batchId;
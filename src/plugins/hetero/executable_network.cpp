@@ -194,7 +194,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
                     colorIndex++;
                 }
             }}
-            .run_on_model(ngraph::clone_function(*function));
+            .run_on_model(std::const_pointer_cast<ov::Model>(function));
     }
 
     NodeMap<InputSet> nodeInputDependencies;
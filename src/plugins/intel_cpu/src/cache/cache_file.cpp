@@ -0,0 +1,36 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cache_file.h"
+
+#include <cstdio>
+#include <fstream>
+
+#ifdef _WIN32
+# include <windows.h>
+#endif
+
+bool ov::intel_cpu::writeCacheFile(const std::string& filePath, const std::string& content) {
+    const auto tmpPath = filePath + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::out | std::ios::trunc | std::ios::binary);
+        if (!file.is_open())
+            return false;
+        file << content;
+        if (!file.good()) {
+            file.close();
+            std::remove(tmpPath.c_str());
+            return false;
+        }
+    }
+#ifdef _WIN32
+    // std::rename fails on Windows if the file exists
+    const bool replaced = MoveFileExA(tmpPath.c_str(), filePath.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    const bool replaced = std::rename(tmpPath.c_str(), filePath.c_str()) == 0;
+#endif
+    if (!replaced)
+        std::remove(tmpPath.c_str());
+    return replaced;
+}
@@ -0,0 +1,24 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Replaces the content of the file stored in the model cache directory.
+ * The content is written to a temporary file, which then replaces the file atomically, so another process reads
+ * either the old or the new content, never a partially written one.
+ *
+ * @param filePath is the path of the file to be replaced
+ * @param content is the new content of the file
+ * @return false if the file could not be written, the old file stays intact in this case
+ */
+bool writeCacheFile(const std::string& filePath, const std::string& content);
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "input_shapes_history.h"
+#include "cache_file.h"
+
+#include <fstream>
+#include <sstream>
+
+using namespace ov::intel_cpu;
+
+namespace {
+// must be changed on any change of the file format
+constexpr const char* header = "CPU_INPUT_SHAPES_HISTORY 1";
+
+// a signature is stored as a single line: [d0,d1,...][d0,d1,...]...
+std::string toString(const InputShapesHistory::Signature& signature) {
+    std::stringstream ss;
+    for (const auto& dims : signature) {
+        ss << '[';
+        for (size_t i = 0; i < dims.size(); ++i) {
+            ss << (i ? "," : "") << dims[i];
+        }
+        ss << ']';
+    }
+    return ss.str();
+}
+
+bool fromString(const std::string& line, InputShapesHistory::Signature& signature) {
+    std::istringstream ss(line);
+    signature.clear();
+    char c;
+    while (ss >> c) {
+        if (c != '[')
+            return false;
+        VectorDims dims;
+        if (ss.peek() != ']') {
+            do {
+                Dim dim;
+                if (!(ss >> dim))
+                    return false;
+                dims.push_back(dim);
+            } while (ss >> c && c == ',');
+            if (c != ']')
+                return false;
+        } else {
+            ss.get();
+        }
+        signature.push_back(std::move(dims));
+    }
+    return !signature.empty();
+}
+}   // namespace
+
+InputShapesHistory::InputShapesHistory(std::string filePath, size_t capacity)
+    : _filePath(std::move(filePath)), _capacity(capacity) {
+    load();
+}
+
+InputShapesHistory::~InputShapesHistory() {
+    save();
+}
+
+std::vector<InputShapesHistory::Signature> InputShapesHistory::getSignatures() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _signatures;
+}
+
+void InputShapesHistory::record(const Signature& signature) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_signatures.size() >= _capacity || _known.count(signature))
+        return;
+    _known.insert(signature);
+    _signatures.push_back(signature);
+    _changed = true;
+}
+
+void InputShapesHistory::load() {
+    std::ifstream file(_filePath);
+    if (!file.is_open())
+        return;
+
+    std::string line;
+    if (!std::getline(file, line) || line != header)
+        return;
+
+    Signature signature;
+    while (_signatures.size() < _capacity && std::getline(file, line)) {
+        // the file is a cache, so a corrupted record is simply skipped
+        if (fromString(line, signature) && _known.insert(signature).second) {
+            _signatures.push_back(signature);
+        }
+    }
+}
+
+void InputShapesHistory::save() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_changed)
+        return;
+    _changed = false;
+    std::stringstream content;
+    content << header << '\n';
+    for (const auto& signature : _signatures) {
+        content << toString(signature) << '\n';
+    }
+    writeCacheFile(_filePath, content.str());
+}
@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+#include "cpu_types.h"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Persistent history of the input shapes a dynamic network has been executed with.
+ * The history is stored in the model cache directory, so after a process restart the network may replay the recorded
+ * shapes at compile time and warm the runtime parameters cache up instead of building primitives on the first
+ * requests of each shape. The recorded signatures are written to the file by save() and on destruction.
+ *
+ * @note This class is thread safe.
+ */
+
+class InputShapesHistory {
+public:
+    // input dims ordered the same way as the graph input nodes
+    using Signature = std::vector<VectorDims>;
+    using Ptr = std::shared_ptr<InputShapesHistory>;
+
+    /**
+     * @param filePath is the path of the file the history is loaded from and saved to
+     * @param capacity is the maximum number of distinct signatures to be recorded
+     */
+    InputShapesHistory(std::string filePath, size_t capacity);
+    ~InputShapesHistory();
+
+    /**
+     * @brief Returns the recorded signatures in the order they were first seen
+     */
+    std::vector<Signature> getSignatures() const;
+
+    /**
+     * @brief Returns the maximum number of distinct signatures to be recorded
+     */
+    size_t getCapacity() const {
+        return _capacity;
+    }
+
+    /**
+     * @brief Adds the signature to the history if it was not recorded yet
+     * @param signature is the input dims of an inference
+     */
+    void record(const Signature& signature);
+
+    /**
+     * @brief Saves the history to the file if new signatures were recorded since the last save
+     */
+    void save();
+
+private:
+    void load();
+
+    mutable std::mutex _mutex;
+    std::string _filePath;
+    size_t _capacity;
+    std::vector<Signature> _signatures;
+    std::set<Signature> _known;
+    bool _changed = false;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
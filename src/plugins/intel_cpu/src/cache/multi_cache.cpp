@@ -6,4 +6,15 @@
 
 using namespace ov::intel_cpu;
 
-std::atomic_size_t MultiCache::_typeIdCounter{0};
\ No newline at end of file
+std::atomic_size_t MultiCache::_typeIdCounter{0};
+CacheEntryBase::Statistics MultiCache::getStatistics() const {
+    CacheEntryBase::Statistics result;
+    std::lock_guard<std::mutex> lock(_storageMutex);
+    for (const auto& item : _storage) {
+        const auto stats = item.second->getStatistics();
+        result.hits += stats.hits;
+        result.misses += stats.misses;
+        result.evictions += stats.evictions;
+    }
+    return result;
+}
@@ -0,0 +1,124 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "lru_cache.h"
+
+/**
+ * @brief Thread safe preemptive cache with LRU eviction policy.
+ * The records are distributed between several independent LruCache shards by the key hash, each shard is guarded
+ * by its own mutex, so concurrent lookups of different keys rarely contend for the same lock.
+ * The LRU policy is applied per shard, so with more than one shard the eviction order is only approximately LRU.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ */
+
+namespace ov {
+namespace intel_cpu {
+
+template<typename Key, typename Value>
+class ShardedLruCache {
+public:
+    /**
+     * @param capacity is the total records limit for all the shards
+     * @note the number of shards is chosen so that each shard holds at least minShardCapacity records,
+     *       thus small caches consist of a single shard and preserve the exact LRU policy
+     */
+    explicit ShardedLruCache(size_t capacity) : _capacity(capacity) {
+        const size_t numShards = std::max<size_t>(1, std::min(maxShards, capacity / minShardCapacity));
+        const size_t shardCapacity = (capacity + numShards - 1) / numShards;
+        _shards.reserve(numShards);
+        for (size_t i = 0; i < numShards; ++i) {
+            _shards.emplace_back(new Shard(shardCapacity));
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     */
+
+    void put(const Key &key, const Value &val) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.cache.put(key, val);
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+
+    Value get(const Key &key) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.get(key);
+    }
+
+    /**
+     * @brief Evicts n least recently used cache records from each shard
+     * @param n number of records to be evicted, can be greater than capacity
+     */
+
+    void evict(size_t n) {
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            shard->cache.evict(n);
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the number of records evicted from all the shards since the cache creation
+     * @return the number of evicted records
+     */
+    size_t getEvictionsCount() const {
+        size_t evictions = 0;
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            evictions += shard->cache.getEvictionsCount();
+        }
+        return evictions;
+    }
+
+private:
+    static constexpr size_t maxShards = 16;
+    static constexpr size_t minShardCapacity = 64;
+
+    struct Shard {
+        explicit Shard(size_t capacity) : cache(capacity) {}
+        mutable std::mutex mutex;
+        LruCache<Key, Value> cache;
+    };
+
+    Shard& getShard(const Key &key) {
+        return *_shards[static_cast<size_t>(key.hash()) % _shards.size()];
+    }
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    size_t _capacity;
+};
+
+template<typename Key, typename Value>
+constexpr size_t ShardedLruCache<Key, Value>::maxShards;
+
+template<typename Key, typename Value>
+constexpr size_t ShardedLruCache<Key, Value>::minShardCapacity;
+
+}   // namespace intel_cpu
+}   // namespace ov
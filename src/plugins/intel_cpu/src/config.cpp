@@ -148,6 +148,27 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_STREAMS_CALIBRATION_TIME == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_STREAMS_CALIBRATION_TIME
+                           << ". Expected only integer numbers";
+            }
+            // any negative value will be treated as zero that means disabling the calibration
+            streamsCalibrationTime = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_WEIGHTS_NUMA_POLICY == key) {
+            if (val == PluginConfigInternalParams::REPLICATE)
+                weightsNumaPolicy = WeightsNumaPolicy::Replicate;
+            else if (val == PluginConfigInternalParams::INTERLEAVE)
+                weightsNumaPolicy = WeightsNumaPolicy::Interleave;
+            else if (val == PluginConfigInternalParams::FIRST_TOUCH)
+                weightsNumaPolicy = WeightsNumaPolicy::FirstTouch;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WEIGHTS_NUMA_POLICY
+                           << ". Expected only " << PluginConfigInternalParams::REPLICATE << "/"
+                           << PluginConfigInternalParams::INTERLEAVE << "/" << PluginConfigInternalParams::FIRST_TOUCH;
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
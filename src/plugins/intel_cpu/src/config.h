@@ -22,12 +22,25 @@ struct Config {
         On,
     };
 
+    enum class WeightsNumaPolicy {
+        Replicate,
+        Interleave,
+        FirstTouch,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
     size_t rtCacheCapacity = 5000ul;
+    // milliseconds, zero disables the calibration of the number of streams
+    int streamsCalibrationTime = 0;
+    // the number of streams chosen by the calibration, zero if it was not calibrated
+    int calibratedNumStreams = 0;
+    // the name of the streams executor taken from the executor manager, the executors are reused by this name
+    std::string streamsExecutorName = "CPUStreamsExecutor";
+    WeightsNumaPolicy weightsNumaPolicy = WeightsNumaPolicy::Replicate;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(__arm__) || defined(__aarch64__)
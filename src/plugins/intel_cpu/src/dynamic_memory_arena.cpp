@@ -0,0 +1,125 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dynamic_memory_arena.h"
+
+#include <algorithm>
+#include <limits>
+
+#include <common/primitive_hashing_utils.hpp>
+#include "edge.h"
+#include "node.h"
+#include "memory_solver.hpp"
+#include "utils/general_utils.h"
+
+namespace ov {
+namespace intel_cpu {
+
+size_t DynamicMemoryArena::ShapesKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    return get_vector_hash(0, dims);
+}
+
+bool DynamicMemoryArena::ShapesKey::operator==(const ShapesKey& rhs) const {
+    return dims == rhs.dims;
+}
+
+DynamicMemoryArena::DynamicMemoryArena(size_t plansCapacity) : _plans(plansCapacity) {}
+
+void DynamicMemoryArena::addCluster(std::vector<MKLDNNEdgePtr> edges, int start, int finish) {
+    std::vector<MKLDNNNodePtr> nodes;
+    for (const auto& edge : edges) {
+        for (const auto& node : {edge->getParent(), edge->getChild()}) {
+            if (std::find(nodes.begin(), nodes.end(), node) == nodes.end()) {
+                nodes.push_back(node);
+            }
+        }
+    }
+    _clusters.push_back({std::move(edges), std::move(nodes), start, finish});
+}
+
+void DynamicMemoryArena::bind(const std::map<std::string, MKLDNNNodePtr>& inputNodes) {
+    // the key vector keeps its capacity, so building it does not allocate in the steady state
+    _currentKey.dims.clear();
+    for (const auto& input : inputNodes) {
+        const auto& node = input.second;
+        if (node->getChildEdges().empty()) {
+            continue;
+        }
+        const auto& dims = node->getChildEdgeAt(0)->getMemory().getStaticDims();
+        _currentKey.dims.insert(_currentKey.dims.end(), dims.begin(), dims.end());
+        _currentKey.dims.push_back(dims.size());
+    }
+
+    if (_isBound && _currentKey == _boundKey) {
+        _currentKeyIsKnown = true;
+        return;
+    }
+
+    const auto plan = _plans.get(_currentKey);
+    _currentKeyIsKnown = plan != nullptr;
+    if (!_currentKeyIsKnown) {
+        // the edges may stay bound to the slices of another plan: each slice belongs to a single cluster and
+        // the clusters with overlapping lifetimes never share the memory, so the bigger memory is just reallocated
+        // (that is why the edges are not considered bound to the plan anymore)
+        _isBound = false;
+        return;
+    }
+
+    // the whole plan is applied, so the edges do not refer to the old buffer after it is reallocated
+    _buffer.resize(plan->size);
+    auto* data = static_cast<uint8_t*>(_buffer.getRawPtr());
+    for (size_t i = 0; i < _clusters.size(); i++) {
+        const auto& slice = plan->slices[i];
+        auto memMngr = _clusters[i].edges.front()->getMemoryPtr()->getDnnlMemoryMngr();
+        const bool moved = memMngr->getRawPtr() != data + slice.first;
+        memMngr->setExtBuff(data + slice.first, slice.second);
+        if (moved) {
+            for (const auto& node : _clusters[i].nodes) {
+                node->resetLastInputDims();
+            }
+        }
+    }
+    _boundKey.dims.assign(_currentKey.dims.begin(), _currentKey.dims.end());
+    _isBound = true;
+}
+
+void DynamicMemoryArena::record() {
+    if (_currentKeyIsKnown) {
+        return;
+    }
+
+    constexpr int64_t alignment = 64;  // cache line
+
+    std::vector<MemorySolver::Box> boxes(_clusters.size());
+    for (size_t i = 0; i < _clusters.size(); i++) {
+        const auto& cluster = _clusters[i];
+        int64_t size = 0;
+        for (const auto& edge : cluster.edges) {
+            const auto& desc = edge->getMemory().getDesc();
+            // the edges of the nodes skipped on this inference (e.g. inactive If branch) may stay undefined
+            if (desc.isDefined()) {
+                size = std::max(size, static_cast<int64_t>(desc.getCurrentMemSize()));
+            }
+        }
+        boxes[i] = {cluster.start, cluster.finish, div_up(size, alignment), static_cast<int64_t>(i)};
+    }
+
+    MemorySolver memSolver(boxes);
+    auto plan = std::make_shared<Plan>();
+    plan->size = static_cast<size_t>(memSolver.solve() * alignment);
+    plan->slices.reserve(boxes.size());
+    for (const auto& box : boxes) {
+        plan->slices.emplace_back(static_cast<size_t>(memSolver.getOffset(box.id) * alignment),
+                                  static_cast<size_t>(box.size * alignment));
+    }
+
+    _plans.put(_currentKey, plan);
+    _currentKeyIsKnown = true;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
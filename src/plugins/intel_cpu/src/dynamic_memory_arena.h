@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "cache/lru_cache.h"
+
+namespace ov {
+namespace intel_cpu {
+
+class MKLDNNEdge;
+class MKLDNNNode;
+using MKLDNNEdgePtr = std::shared_ptr<MKLDNNEdge>;
+using MKLDNNNodePtr = std::shared_ptr<MKLDNNNode>;
+
+/**
+ * @brief Grow-only memory arena for the graph edges with undefined memory size (i.e. dynamic shapes).
+ * The static edges are packed by the MemorySolver once on the graph allocation, while the dynamic edges redefine
+ * (and potentially reallocate) their memory on every new shape. The arena records the memory sizes the dynamic edges
+ * took on the first inference with a given input shapes signature, packs them with the MemorySolver and caches the
+ * offsets by the signature. Next inferences with the same signature just bind the edges to the arena slices, so the
+ * steady state does not perform any memory (re)allocations.
+ *
+ * @attention This class IS NOT THREAD SAFE! It is owned by the graph, which executes one inference at a time.
+ */
+
+class DynamicMemoryArena {
+public:
+    /**
+     * @param plansCapacity is the maximum number of the input shapes signatures the offsets are cached for
+     */
+    explicit DynamicMemoryArena(size_t plansCapacity);
+
+    /**
+     * @brief Adds the set of edges sharing the same memory
+     * @param edges is the set of edges, the first one is the edge that owns the memory
+     * @param start is the execution index of the node producing the memory
+     * @param finish is the execution index of the last node consuming the memory
+     */
+    void addCluster(std::vector<MKLDNNEdgePtr> edges, int start, int finish);
+
+    /**
+     * @brief Binds the dynamic edges to the arena slices, if the offsets for the current input shapes are known
+     * @param inputNodes is the graph input nodes with the already defined output memory
+     */
+    void bind(const std::map<std::string, MKLDNNNodePtr>& inputNodes);
+
+    /**
+     * @brief Computes and caches the offsets of the dynamic edges for the input shapes passed to the last bind() call,
+     * if they are not cached yet. Must be called after the inference
+     */
+    void record();
+
+private:
+    struct Cluster {
+        std::vector<MKLDNNEdgePtr> edges;
+        std::vector<MKLDNNNodePtr> nodes;  // the producers and consumers of the memory
+        int start;
+        int finish;
+    };
+
+    struct ShapesKey {
+        std::vector<size_t> dims;  // flattened input dims, each dims vector is followed by its rank
+
+        size_t hash() const;
+        bool operator==(const ShapesKey& rhs) const;
+    };
+
+    struct Plan {
+        size_t size;                                      // in bytes
+        std::vector<std::pair<size_t, size_t>> slices;    // offset and size (in bytes) per cluster
+    };
+    using PlanPtr = std::shared_ptr<const Plan>;
+
+    std::vector<Cluster> _clusters;
+    LruCache<ShapesKey, PlanPtr> _plans;
+    ShapesKey _currentKey;
+    ShapesKey _boundKey;
+    bool _isBound = false;
+    bool _currentKeyIsKnown = false;
+    MemoryMngrWithReuse _buffer;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
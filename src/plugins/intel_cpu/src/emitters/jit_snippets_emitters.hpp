@@ -7,7 +7,10 @@
 #include <ngraph/rt_info.hpp>
 #include <ngraph/variant.hpp>
 
+#include <ie_ngraph_utils.hpp>
+
 #include "jit_emitter.hpp"
+#include "jit_load_store_emitters.hpp"
 
 using namespace Xbyak;
 
@@ -21,6 +24,11 @@ namespace intel_cpu {
 struct jit_snippets_call_args {
     const void *src_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     void *dst_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
+    // the scheduling info is read from here by the kernels compiled with the runtime scheduling only,
+    // the layout is the same as in jit_snippets_compile_args
+    int64_t scheduler_dims[SNIPPETS_MAX_TILE_RANK] = {};
+    int64_t scheduler_offsets[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
+    int64_t data_offsets[SNIPPETS_MAX_SNIPPETS_DIMS * SNIPPETS_MAX_HARNESS_DIMS] = {};
 };
 
 struct jit_snippets_compile_args {
@@ -28,6 +36,11 @@ struct jit_snippets_compile_args {
     int64_t scheduler_offsets[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     int64_t data_offsets[SNIPPETS_MAX_SNIPPETS_DIMS * SNIPPETS_MAX_HARNESS_DIMS] = {};
     std::vector<size_t> output_dims = {};
+    // the element sizes of the inputs followed by the outputs
+    int64_t data_sizes[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
+    // if set, the scheduler dims and the offsets above are not used: the kernel reads them from jit_snippets_call_args,
+    // so it can be executed for any shapes with the same ranks and broadcasting pattern (i.e. for dynamic shapes)
+    bool runtime_scheduling = false;
 };
 ///
 /// \brief    Kernel is the only entry point to Codogen Jit compilation. Kernel calculates appropriate data offsets,
@@ -49,6 +62,9 @@ struct jit_snippets_compile_args {
 /// \param      in[0]       The number of the node inputs
 /// \param      in[1]      The number of the node outputs
 ///
+/// The pointer to jit_snippets_call_args is kept in abi_param2 during the whole kernel, so the enclosed tiles
+/// can read the scheduling info from it in the runtime scheduling mode.
+///
 // Todo: Scheduler dims and offsets are currently calculated in MKLDNN Subgraph node and passed to the KernelEmitter.
 //  However, it seems more natural to calculate all the offsets right in the Kernel op, because the calculation is
 //  not device-specific. It is based only on input/output dims (which we already know) and harness num dims
@@ -120,13 +136,23 @@ private:
                 }
             }
         };
+        auto init_ptrs_with_runtime_offsets = [&](Reg64 pointer, size_t offsets_idx) {
+            for (int j = 0; j < harness_num_dims; j++) {
+                h->mov(reg_tmp_64, h->ptr[reg_const_params + GET_OFF(data_offsets) + (offsets_idx + j) * sizeof(int64_t)]);
+                h->imul(reg_tmp_64, h->ptr[reg_indexes + j * sizeof(size_t)]);
+                h->add(pointer, reg_tmp_64);
+            }
+        };
         for (auto i = 0; i < num_params; i++) {
             regs[i] = Reg64(reg64_tmp_start + i);
             if (i < num_inputs)
                 h->mov(regs[i], h->ptr[reg_const_params + GET_OFF(src_ptrs) + i * sizeof(void*)]);
             else
                 h->mov(regs[i], h->ptr[reg_const_params + GET_OFF(dst_ptrs) + (i - num_inputs) * sizeof(void*)]);
-            init_ptrs_with_offsets(regs[i], &jcp.data_offsets[i * harness_num_dims]);
+            if (jcp.runtime_scheduling)
+                init_ptrs_with_runtime_offsets(regs[i], i * harness_num_dims);
+            else
+                init_ptrs_with_offsets(regs[i], &jcp.data_offsets[i * harness_num_dims]);
         }
 
         for (auto& c : code) {
@@ -150,6 +176,8 @@ private:
 /// So previous_inc is zero for outer and vector tiles (the are the first in dim) and vlen for scalar tiles (they usually go after vector Tiles).
 /// \param      in[2]    sum number inputs and number of outputs of the node.
 /// \param      in[3]    dimension of the tile. Note that only 2d Tile are currently supported, so dim is 0 for outer tiles, 1 for inner tiles.
+/// \param      in[4..]  optional indexes of the parameters, which pointers are rewound to the beginning of the row after the tile,
+/// since the row is read again by the next row pass (see ngraph::snippets::pass::SplitRowPasses). Expected only for the scalar tiles.
 ///
 // Todo: Inner and outer tiles have different semantics. For example, outer tile always has the increment == 1, and it can contain only
 //  tile emitters (one outer or two inner). So it seems better to create different classes for inner and outer tiles.
@@ -180,8 +208,8 @@ public:
 private:
     void validate_arguments(const std::vector<size_t> &in, const std::vector<size_t> &out,
                             const std::vector<size_t> &pool = {}, const std::vector<size_t> &gpr = {}) const override {
-        if (in.size() != 4)
-            IE_THROW() << "TileEmitter got invalid number of inputs. Expected 4, got " << in.size();
+        if (in.size() < 4)
+            IE_THROW() << "TileEmitter got invalid number of inputs. Expected at least 4, got " << in.size();
         if (out.size() != 0)
             IE_THROW() << "TileEmitter got unexpected output arguments.";
         const size_t num_params = in[2];
@@ -192,6 +220,10 @@ private:
         if (dim >= SNIPPETS_MAX_TILE_RANK)
             IE_THROW() << "TileEmitter supports tile ranks up to " << SNIPPETS_MAX_TILE_RANK <<
                        " got " << dim;
+        for (size_t i = 4; i < in.size(); i++) {
+            if (in[i] >= num_params)
+                IE_THROW() << "TileEmitter got invalid parameter index to rewind: " << in[i];
+        }
     }
 
     void emit_impl(const std::vector<size_t>& in,
@@ -213,21 +245,8 @@ private:
         std::vector<Reg64> regs(num_params);
         for (auto i = 0; dim == 0 && i < num_params; i++)
             regs[i] = Reg64(reg64_tmp_start + i);
-        // Loop processing could be simplified in some cases
-        if (inc > jcp.scheduler_dims[dim]) {
-            return;
-        } else if (inc == jcp.scheduler_dims[dim]) {
-            for (auto& c : code) {
-                c.first->emit_code(c.second.first, c.second.second, pool, local_gpr);
-            }
-        } else {
-            // The previous tile has done nothing, all the work is ours
-            if (previous_inc == 0 || previous_inc > jcp.scheduler_dims[dim]) {
-                h->mov(amount, jcp.scheduler_dims[dim]);
-            // The previous tile has done all the work
-            } else if (jcp.scheduler_dims[dim] % previous_inc == 0) {
-                return;
-            }// else: the previous tile has already set a proper work amount
+        Reg64 reg_const_params { dnnl::impl::cpu::x64::abi_param2 };
+        auto emit_loop = [&]() {
             h->cmp(amount, inc);
             h->jl(for_body[0], CodeGenerator::T_NEAR);
 
@@ -242,7 +261,9 @@ private:
                 //   after reading/writing. This might be a problem if we need to read the same data multiple times (broadcasting shapes).
                 //   To overcome this limitation, we add appropriate negative offsets if necessary.
                 for (auto i = 0; dim == 0 && i < num_params; i++) {
-                    if (jcp.scheduler_offsets[i] != 0) {
+                    if (jcp.runtime_scheduling) {
+                        h->add(regs[i], h->ptr[reg_const_params + GET_OFF(scheduler_offsets) + i * sizeof(int64_t)]);
+                    } else if (jcp.scheduler_offsets[i] != 0) {
                         h->add(regs[i], jcp.scheduler_offsets[i]);
                     }
                 }
@@ -252,7 +273,44 @@ private:
             }
 
             h->L(for_body[0]);
+        };
+
+        if (jcp.runtime_scheduling) {
+            // The work amount is unknown at compile time, so the loop is always emitted
+            if (previous_inc == 0) {
+                h->mov(amount, h->ptr[reg_const_params + GET_OFF(scheduler_dims) + dim * sizeof(int64_t)]);
+            }// else: the previous tile has already set the remaining work amount
+            emit_loop();
+            // The whole row has been read by this and the previous tile, so the pointers are moved back to its beginning.
+            // The work amount register is free here, since the rewinding tile is the last one in the row
+            for (size_t i = 4; i < in.size(); i++) {
+                h->mov(amount, h->ptr[reg_const_params + GET_OFF(scheduler_dims) + dim * sizeof(int64_t)]);
+                h->imul(amount, amount, static_cast<int>(jcp.data_sizes[in[i]]));
+                h->sub(Reg64(reg64_tmp_start + in[i]), amount);
+            }
+            return;
         }
+
+        // The previous tile has done all the work
+        const bool work_is_done = previous_inc != 0 && previous_inc <= jcp.scheduler_dims[dim] &&
+                                  jcp.scheduler_dims[dim] % previous_inc == 0;
+        // Loop processing could be simplified in some cases
+        if (inc > jcp.scheduler_dims[dim] || (inc < jcp.scheduler_dims[dim] && work_is_done)) {
+            // nothing to do
+        } else if (inc == jcp.scheduler_dims[dim]) {
+            for (auto& c : code) {
+                c.first->emit_code(c.second.first, c.second.second, pool, local_gpr);
+            }
+        } else {
+            // The previous tile has done nothing, all the work is ours
+            if (previous_inc == 0 || previous_inc > jcp.scheduler_dims[dim]) {
+                h->mov(amount, jcp.scheduler_dims[dim]);
+            }// else: the previous tile has already set a proper work amount
+            emit_loop();
+        }
+        // The whole row has been read by this and the previous tile, so the pointers are moved back to its beginning
+        for (size_t i = 4; i < in.size(); i++)
+            h->sub(Reg64(reg64_tmp_start + in[i]), jcp.scheduler_dims[dim] * jcp.data_sizes[in[i]]);
     }
 
     // A = <42, 17>
@@ -404,6 +462,217 @@ private:
     int32_t value;
 };
 
+///
+/// \brief    Converts the data between the element types in registers. The data in registers is always f32,
+/// so the conversion just rounds the values to the ones representable by the destination type:
+/// the integer types are truncated and saturated like MKLDNNConvertNode does, bf16 is rounded to the nearest even.
+/// The actual conversion of the data representation is performed by the Load/Store emitters.
+///
+class ConvertEmitter : public jit_emitter {
+public:
+    ConvertEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n), dst_type(n->get_output_element_type(0)) {
+        if (!dnnl::impl::utils::one_of(dst_type, ov::element::f32, ov::element::bf16, ov::element::i8, ov::element::u8))
+            IE_THROW() << "ConvertEmitter doesn't support conversion to " << dst_type;
+        prepare_table();
+    }
+
+    size_t get_inputs_num() const override {return 1;}
+
+protected:
+    size_t aux_vecs_count() const override {return dst_type == ov::element::bf16 ? 1 : 0;}
+
+private:
+    void register_table_entries() override {
+        if (dst_type == ov::element::bf16) {
+            push_arg_entry_of("one", 0x00000001, true);
+            push_arg_entry_of("even", 0x00007fff, true);
+            push_arg_entry_of("bf16_mask", 0xffff0000, true);
+        } else if (dst_type.is_integral()) {
+            const bool is_signed = dst_type == ov::element::i8;
+            push_arg_entry_of("lbound", mkldnn::impl::cpu::x64::float2int(is_signed ? -128.f : 0.f), true);
+            push_arg_entry_of("ubound", mkldnn::impl::cpu::x64::float2int(is_signed ? 127.f : 255.f), true);
+        }
+    }
+
+    void emit_impl(const std::vector<size_t>& in,
+              const std::vector<size_t>& out,
+              const std::vector<size_t>& pool,
+              const std::vector<size_t>& gpr,
+              const ov::intel_cpu::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                    Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+        Vmm vmm_src = Vmm(in[0]);
+        Vmm vmm_dst = Vmm(out[0]);
+
+        if (dst_type == ov::element::bf16) {
+            // dst = (src + 0x7fff + ((src >> 16) & 1)) & 0xffff0000
+            Vmm vmm_aux = Vmm(aux_vec_idxs[0]);
+            h->uni_vmovups(vmm_aux, vmm_src);
+            h->uni_vpsrld(vmm_aux, vmm_aux, 16);
+            bitwise_and<Vmm>(vmm_aux, table_val("one"));
+            h->uni_vpaddd(vmm_aux, vmm_aux, table_val("even"));
+            if (vmm_dst.getIdx() != vmm_src.getIdx())
+                h->uni_vmovups(vmm_dst, vmm_src);
+            h->uni_vpaddd(vmm_dst, vmm_dst, vmm_aux);
+            bitwise_and<Vmm>(vmm_dst, table_val("bf16_mask"));
+        } else if (dst_type.is_integral()) {
+            h->uni_vroundps(vmm_dst, vmm_src, 3); // truncate
+            h->uni_vmaxps(vmm_dst, vmm_dst, table_val("lbound"));
+            h->uni_vminps(vmm_dst, vmm_dst, table_val("ubound"));
+        } else if (vmm_dst.getIdx() != vmm_src.getIdx()) {
+            h->uni_vmovups(vmm_dst, vmm_src);
+        }
+    }
+
+    template <typename Vmm>
+    void bitwise_and(const Vmm& vmm, const Xbyak::Address& mask) const {
+        // vandps can't be used for zmm without avx512dq
+        if (std::is_same<Vmm, Xbyak::Zmm>::value) {
+            h->vpandd(vmm, vmm, mask);
+        } else {
+            h->uni_vandps(vmm, vmm, mask);
+        }
+    }
+
+private:
+    ov::element::Type dst_type;
+};
+
+///
+/// \brief    Accumulates the input into the RowReduce accumulator: out[0] = op(out[0], in[0]).
+/// The accumulator register is reserved for the whole row (see ngraph::snippets::pass::AssignRegisters),
+/// so it's also the implicit input of the operation.
+///
+class RowReduceEmitter : public jit_emitter {
+public:
+    RowReduceEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n), is_max(ov::is_type<ngraph::snippets::op::RowMax>(n)) {
+    }
+
+    size_t get_inputs_num() const override {return 1;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+              const std::vector<size_t>& out,
+              const std::vector<size_t>& pool,
+              const std::vector<size_t>& gpr,
+              const ov::intel_cpu::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                    Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+        Vmm vmm_src = Vmm(in[0]);
+        Vmm vmm_acc = Vmm(out[0]);
+
+        if (is_max) {
+            h->uni_vmaxps(vmm_acc, vmm_acc, vmm_src);
+        } else {
+            h->uni_vaddps(vmm_acc, vmm_acc, vmm_src);
+        }
+    }
+
+private:
+    bool is_max;
+};
+
+///
+/// \brief    Reduces the vector lanes of the RowReduce accumulator and broadcasts the result to all the lanes.
+/// It's emitted by the Generator between the vector and the scalar tiles of a row pass, so in[0] == out[0].
+///
+class HorizonReduceEmitter : public jit_emitter {
+public:
+    HorizonReduceEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n), is_max(ov::is_type<ngraph::snippets::op::HorizonMax>(n)) {
+    }
+
+    size_t get_inputs_num() const override {return 1;}
+
+protected:
+    size_t aux_vecs_count() const override {return 1;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+              const std::vector<size_t>& out,
+              const std::vector<size_t>& pool,
+              const std::vector<size_t>& gpr,
+              const ov::intel_cpu::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <typename Vmm>
+    void reduce(const Vmm& vmm_acc, const Vmm& vmm_aux) const {
+        if (is_max) {
+            h->uni_vmaxps(vmm_acc, vmm_acc, vmm_aux);
+        } else {
+            h->uni_vaddps(vmm_acc, vmm_acc, vmm_aux);
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                    Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+        if (in[0] != out[0])
+            IE_THROW() << "HorizonReduceEmitter expects the same input and output registers";
+        const auto acc = static_cast<int>(out[0]);
+        const auto aux = static_cast<int>(aux_vec_idxs[0]);
+
+        // zmm -> ymm -> xmm -> pairs of lanes -> single lane
+        if (isa == dnnl::impl::cpu::x64::avx512_common) {
+            h->vextractf64x4(Ymm(aux), Zmm(acc), 1);
+            reduce(Ymm(acc), Ymm(aux));
+        }
+        if (isa != dnnl::impl::cpu::x64::sse41) {
+            h->vextractf128(Xmm(aux), Ymm(acc), 1);
+            reduce(Xmm(acc), Xmm(aux));
+        }
+        h->uni_vshufps(Xmm(aux), Xmm(acc), Xmm(acc), 0x4E);
+        reduce(Xmm(acc), Xmm(aux));
+        h->uni_vshufps(Xmm(aux), Xmm(acc), Xmm(acc), 0xB1);
+        reduce(Xmm(acc), Xmm(aux));
+        h->uni_vbroadcastss(Vmm(acc), Xmm(acc));
+    }
+
+private:
+    bool is_max;
+};
+
 ///
 /// Memory emitters:
 ///
@@ -415,12 +684,21 @@ private:
 /// Blocked parameter to tell if input is actually blocked. Broadcast means broadcast by W in other cases no need to substitute load.
 class MemoryEmitter : public jit_emitter  {
 public:
-    MemoryEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
-    : jit_emitter(h, isa, n), ea(getEA(n)) {
+    MemoryEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n,
+                  const ov::element::Type& memory_type)
+    : jit_emitter(h, isa, n), ea(getEA(n)), memory_prc(InferenceEngine::details::convertPrecision(memory_type)) {
     }
 
     size_t get_inputs_num() const override {return 1;}
 
+    void emit_data() const override {
+        jit_emitter::emit_data();
+        if (load_emitter)
+            load_emitter->emit_data();
+        if (store_emitter)
+            store_emitter->emit_data();
+    }
+
 protected:
     static auto getEA(const std::shared_ptr<ov::Node>& n) -> size_t {
         auto& rt = n->get_rt_info();
@@ -434,13 +712,56 @@ protected:
         return ea;
     }
 
+    // The data in registers is always f32, so it's converted by the nested emitters only if the memory has another precision
+    void init_load_conversion(int load_num) {
+        if (memory_prc == InferenceEngine::Precision::FP32)
+            return;
+        load_emitter.reset(new jit_load_emitter(h, host_isa_, InferenceEngine::Precision::FP32, emitter_in_out_map::gpr_to_vec));
+        load_context = std::make_shared<load_emitter_context>(memory_prc, InferenceEngine::Precision::FP32, load_num);
+    }
+
+    void init_store_conversion(int store_num) {
+        if (memory_prc == InferenceEngine::Precision::FP32)
+            return;
+        store_emitter.reset(new jit_store_emitter(h, host_isa_, InferenceEngine::Precision::FP32, emitter_in_out_map::vec_to_gpr));
+        store_context = std::make_shared<store_emitter_context>(InferenceEngine::Precision::FP32, memory_prc, store_num);
+    }
+
+    // jit_store_emitter converts the data in place, so the data is stored from a copy to keep the source register alive.
+    // On sse41 the first aux register is xmm0, which is the mask of the nested emitter, so the second one is used for the copy
+    size_t aux_vecs_count() const override {return store_emitter ? 2 : 0;}
+
+    template <typename Vmm>
+    void emit_converting_load(const Vmm& vmm_dst) const {
+        load_emitter->emit_code({ea}, {static_cast<size_t>(vmm_dst.getIdx())}, load_context, {}, {});
+    }
+
+    template <typename Vmm>
+    void emit_converting_store(const Vmm& vmm_src) const {
+        Vmm vmm_copy = Vmm(aux_vec_idxs[1]);
+        h->uni_vmovups(vmm_copy, vmm_src);
+        store_emitter->emit_code({static_cast<size_t>(vmm_copy.getIdx())}, {ea}, store_context, {}, {});
+    }
+
+    // The number of bytes occupied in memory by the data of a vector register
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    size_t vector_memory_size() const {
+        return mkldnn::impl::cpu::x64::cpu_isa_traits<isa>::vlen / sizeof(float) * memory_prc.size();
+    }
+
     size_t ea;
+    InferenceEngine::Precision memory_prc;
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+    std::shared_ptr<const load_emitter_context> load_context = nullptr;
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
+    std::shared_ptr<const store_emitter_context> store_context = nullptr;
 };
 
 class StoreEmitter : public MemoryEmitter  {
 public:
     StoreEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
-    : MemoryEmitter(h, isa, n) {
+    : MemoryEmitter(h, isa, n, n->get_output_element_type(0)) {
+        init_store_conversion(get_vec_length() / sizeof(float));
     }
 
     size_t get_inputs_num() const override {return 1;}
@@ -469,15 +790,20 @@ private:
                                     Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
         Reg64 out_reg(ea);
         Vmm vmm_src0 = Vmm(in[0]);
-        h->uni_vmovups(h->ptr[out_reg], vmm_src0);
-        h->add(out_reg, mkldnn::impl::cpu::x64::cpu_isa_traits<isa>::vlen);
+        if (store_emitter) {
+            emit_converting_store(vmm_src0);
+        } else {
+            h->uni_vmovups(h->ptr[out_reg], vmm_src0);
+        }
+        h->add(out_reg, vector_memory_size<isa>());
     }
 };
 
 class ScalarStoreEmitter : public MemoryEmitter {
 public:
     ScalarStoreEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
-    : MemoryEmitter(h, isa, n) {
+    : MemoryEmitter(h, isa, n, n->get_output_element_type(0)) {
+        init_store_conversion(1);
     }
 
     size_t get_inputs_num() const override {return 1;}
@@ -505,16 +831,21 @@ private:
         using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
                                         Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
         Reg64 out_reg(ea);
-        Xmm vmm_src0 = Xmm(in[0]);
-        h->uni_vmovss(h->ptr[out_reg], vmm_src0);
-        h->add(out_reg, sizeof(float));
+        if (store_emitter) {
+            emit_converting_store(Vmm(in[0]));
+        } else {
+            Xmm vmm_src0 = Xmm(in[0]);
+            h->uni_vmovss(h->ptr[out_reg], vmm_src0);
+        }
+        h->add(out_reg, memory_prc.size());
     }
 };
 
 class LoadEmitter : public MemoryEmitter {
 public:
     LoadEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
-    : MemoryEmitter(h, isa, n), shouldPostIncrement(*n->get_input_shape(0).rbegin() != 1) {
+    : MemoryEmitter(h, isa, n, n->get_input_element_type(0)), shouldPostIncrement(*n->get_input_shape(0).rbegin() != 1) {
+        init_load_conversion(get_vec_length() / sizeof(float));
     }
 
     size_t get_inputs_num() const override {return 0;}
@@ -543,10 +874,14 @@ private:
                                             Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
         Reg64 in_reg(ea);
         Vmm vmm_src0 = Vmm(out[0]);
-        h->uni_vmovups(vmm_src0, h->ptr[in_reg]);
+        if (load_emitter) {
+            emit_converting_load(vmm_src0);
+        } else {
+            h->uni_vmovups(vmm_src0, h->ptr[in_reg]);
+        }
 
         if (shouldPostIncrement) {
-            h->add(in_reg, mkldnn::impl::cpu::x64::cpu_isa_traits<isa>::vlen);
+            h->add(in_reg, vector_memory_size<isa>());
         }
     }
 
@@ -557,7 +892,8 @@ private:
 class BroadcastLoadEmitter : public MemoryEmitter {
 public:
     BroadcastLoadEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
-    : MemoryEmitter(h, isa, n) {
+    : MemoryEmitter(h, isa, n, n->get_input_element_type(0)) {
+        init_load_conversion(1);
     }
     size_t get_inputs_num() const override {return 0;}
 
@@ -588,14 +924,20 @@ private:
 
         // In doesn't really matter if we broadcast or `movss` for vector tails so keep only one version for `BroadcastLoad`,
         // key point here is not to add post-increment, it might be fixed by some other approach in future
-        h->uni_vbroadcastss(vmm_src0, h->ptr[in_reg]);
+        if (load_emitter) {
+            emit_converting_load(vmm_src0);
+            h->uni_vbroadcastss(vmm_src0, Xmm(out[0]));
+        } else {
+            h->uni_vbroadcastss(vmm_src0, h->ptr[in_reg]);
+        }
     }
 };
 
 class ScalarLoadEmitter : public MemoryEmitter {
 public:
     ScalarLoadEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
-    : MemoryEmitter(h, isa, n), shouldPostIncrement(*n->get_input_shape(0).rbegin() != 1) {
+    : MemoryEmitter(h, isa, n, n->get_input_element_type(0)), shouldPostIncrement(*n->get_input_shape(0).rbegin() != 1) {
+        init_load_conversion(1);
     }
     size_t get_inputs_num() const override {return 0;}
 
@@ -622,12 +964,16 @@ private:
         using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
                                             Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
         Reg64 in_reg(ea);
-        Xmm vmm_src0 = Xmm(out[0]);
-        h->uni_vmovss(vmm_src0, h->ptr[in_reg]);
+        if (load_emitter) {
+            emit_converting_load(Vmm(out[0]));
+        } else {
+            Xmm vmm_src0 = Xmm(out[0]);
+            h->uni_vmovss(vmm_src0, h->ptr[in_reg]);
+        }
 
         // Doesn't work if the same pointer comes with multiple load operations
         if (shouldPostIncrement) {
-            h->add(in_reg, sizeof(float));
+            h->add(in_reg, memory_prc.size());
         }
     }
 
@@ -21,12 +21,17 @@
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <ie_system_conf.h>
 #include <ngraph/opsets/opset1.hpp>
+#include <ngraph/log.hpp>
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/util/common_util.hpp"
+#include "transformations/hash.hpp"
+#include <file_utils.h>
+#include <common/primitive_hashing_utils.hpp>
 
 #include <algorithm>
 #include <unordered_set>
@@ -82,6 +87,8 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
 
     _cfg.isNewApi = !isLegacyAPI();
 
+    _rtParamsCache = std::make_shared<MultiCache>(_cfg.rtCacheCapacity);
+
     // WA for inference dynamic batch cases in new API
     if (_cfg.isNewApi) {
         int64_t maxBatchSize = -1;
@@ -101,7 +108,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         _taskExecutor = _plugin->executorManager()->getExecutor("CPU");
     } else {
         auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig, isFloatModel);
-        streamsExecutorConfig._name = "CPUStreamsExecutor";
+        streamsExecutorConfig._name = _cfg.streamsExecutorName;
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         _taskExecutor = std::make_shared<TBBStreamsExecutor>(streamsExecutorConfig);
 #else
@@ -134,6 +141,10 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         MKLDNNExecNetwork::GetGraph();
     }
 
+    if (!_cfg.cache_dir.empty()) {
+        WarmUpRuntimeCache();
+    }
+
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
     // producer as storage for tensor to keep it between infer calls.
@@ -144,7 +155,6 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                 if (!memoryNode) {
                     IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
                 }
-                auto state_store = memoryNode->getStore();
                 auto state_name = memoryNode->getId();
 
                 // Remove suffix with pair ID. Internal information.
@@ -152,12 +162,48 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                 if (suffix_idx != std::string::npos)
                     state_name = state_name.substr(0, suffix_idx);
 
-                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+                memoryStates.emplace_back(new MKLDNNVariableState(state_name, memoryNode->getStoreDesc()));
             }
         }
     }
 }
 
+void MKLDNNExecNetwork::WarmUpRuntimeCache() {
+    // limits both the history file size and the compile time spent on the warm up
+    constexpr size_t maxInputShapesHistorySize = 64;
+
+    auto graphLock = GetGraph();
+    auto& graph = graphLock._graph;
+    if (!graph.hasDynamicInput())
+        return;
+    // the warm up inference must not change the state of the network
+    for (auto &node : graph.GetNodes()) {
+        if (node->getType() == MemoryInput)
+            return;
+    }
+
+    // the recorded shapes are valid only for the same model, compile options and ISA
+    uint64_t seed = 0;
+    ov::pass::Hash(seed).run_on_model(std::const_pointer_cast<ov::Model>(_network.getFunction()));
+    for (const auto& item : _cfg._config) {
+        seed = dnnl::impl::hash_combine(seed, item.first + item.second);
+    }
+    seed = dnnl::impl::hash_combine(seed, static_cast<int>(dnnl::get_effective_cpu_isa()));
+    const auto filePath = FileUtils::makePath(_cfg.cache_dir, std::to_string(seed) + ".cpu_shapes");
+
+    _inputShapesHistory = std::make_shared<InputShapesHistory>(filePath, maxInputShapesHistorySize);
+    // since the runtime parameters cache is shared between the streams, warming one graph is enough
+    for (const auto& signature : _inputShapesHistory->getSignatures()) {
+        try {
+            graph.WarmUp(signature);
+        } catch (const std::exception& e) {
+            // the warm up is an optimization only, the shapes which can not be inferred without the execution
+            // are prepared on the first inference as usual
+            NGRAPH_WARN << "CPU plugin: the runtime cache warm up of " << graph.GetName() << " failed: " << e.what();
+        }
+    }
+}
+
 MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
     int streamId = 0;
     int numaNodeId = 0;
@@ -175,7 +221,8 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
-                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
+                graphLock._graph.CreateGraph(_network, extensionManager,
+                                             _numaNodesWeights.get(numaNodeId, _cfg.weightsNumaPolicy), _rtParamsCache);
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -259,6 +306,9 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetricLegacy(const std::string
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(EXEC_NETWORK_METRIC_KEY(CPU_RUNTIME_CACHE_STATISTICS));
+        metrics.push_back(EXEC_NETWORK_METRIC_KEY(CPU_ZERO_COPY_STATISTICS));
+        metrics.push_back(EXEC_NETWORK_METRIC_KEY(CPU_WEIGHTS_NUMA_STATISTICS));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -273,6 +323,24 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetricLegacy(const std::string
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == EXEC_NETWORK_METRIC_KEY(CPU_RUNTIME_CACHE_STATISTICS)) {
+        const auto stats = _rtParamsCache->getStatistics();
+        IE_SET_METRIC_RETURN(CPU_RUNTIME_CACHE_STATISTICS, {
+            {"HITS", stats.hits},
+            {"MISSES", stats.misses},
+            {"EVICTIONS", stats.evictions}});
+    } else if (name == EXEC_NETWORK_METRIC_KEY(CPU_ZERO_COPY_STATISTICS)) {
+        IE_SET_METRIC_RETURN(CPU_ZERO_COPY_STATISTICS, {
+            {"INPUTS_ZERO_COPY", _zeroCopyCounters.inputsZeroCopy.load()},
+            {"INPUTS_COPIED", _zeroCopyCounters.inputsCopied.load()},
+            {"OUTPUTS_ZERO_COPY", _zeroCopyCounters.outputsZeroCopy.load()},
+            {"OUTPUTS_COPIED", _zeroCopyCounters.outputsCopied.load()}});
+    } else if (name == EXEC_NETWORK_METRIC_KEY(CPU_WEIGHTS_NUMA_STATISTICS)) {
+        std::map<std::string, uint64_t> stats;
+        for (const auto& node : _numaNodesWeights.getBytesPerNode(_cfg.weightsNumaPolicy)) {
+            stats[node.first < 0 ? "UNKNOWN" : "NODE_" + std::to_string(node.first)] = node.second;
+        }
+        IE_SET_METRIC_RETURN(CPU_WEIGHTS_NUMA_STATISTICS, stats);
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -537,6 +605,10 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &ne
 }
 
 void MKLDNNExecNetwork::Export(std::ostream& modelStream) {
-    CNNNetworkSerializer serializer(modelStream, extensionManager);
+    CNNNetworkSerializer serializer(modelStream, extensionManager, _cfg.calibratedNumStreams);
     serializer <<_network;
+
+    // the cached network is imported with the shapes recorded so far
+    if (_inputShapesHistory)
+        _inputShapesHistory->save();
 }
@@ -9,6 +9,7 @@
 
 #include "graph.h"
 #include "extension_mngr.h"
+#include "cache/input_shapes_history.h"
 #include <threading/ie_thread_local.hpp>
 
 #include <vector>
@@ -68,6 +69,18 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<Graph>                   _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
+    // runtime parameters cache shared between the graphs of all the streams
+    MultiCachePtr                               _rtParamsCache;
+    // input shapes the network was executed with, saved to the model cache directory on export and destruction
+    InputShapesHistory::Ptr                     _inputShapesHistory;
+    // number of the inputs/outputs bound to the user memory (zero-copy) vs copied, over all infer requests
+    struct ZeroCopyCounters {
+        std::atomic<uint64_t> inputsZeroCopy = {0};
+        std::atomic<uint64_t> inputsCopied = {0};
+        std::atomic<uint64_t> outputsZeroCopy = {0};
+        std::atomic<uint64_t> outputsCopied = {0};
+    };
+    ZeroCopyCounters                            _zeroCopyCounters;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -80,6 +93,8 @@ protected:
 
     bool isLegacyAPI() const;
 
+    void WarmUpRuntimeCache();
+
     InferenceEngine::Parameter GetConfigLegacy(const std::string &name) const;
 
     InferenceEngine::Parameter GetMetricLegacy(const std::string &name, const Graph& graph) const;
@@ -62,7 +62,7 @@ mkldnn::engine MKLDNNGraph::eng(mkldnn::engine::kind::cpu, 0);
 
 template<typename NET>
 void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMgr,
-        MKLDNNWeightsSharing::Ptr &w_cache) {
+        MKLDNNWeightsSharing::Ptr &w_cache, const MultiCachePtr& rtCache) {
     OV_ITT_SCOPE(FIRST_INFERENCE, ov::intel_cpu::itt::domains::intel_cpu_LT, "CreateGraph");
 
     if (IsReady())
@@ -70,7 +70,7 @@ void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMg
     // disable weights caching if graph was created only once
     weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
 
-    rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+    rtParamsCache = rtCache ? rtCache : std::make_shared<MultiCache>(config.rtCacheCapacity);
 
     Replicate(net, extMgr);
     InitGraph();
@@ -113,9 +113,9 @@ void MKLDNNGraph::CreateGraph(const std::vector<MKLDNNNodePtr> &graphNodes,
 }
 
 template void MKLDNNGraph::CreateGraph(const std::shared_ptr<const ngraph::Function>&,
-        const MKLDNNExtensionManager::Ptr&, MKLDNNWeightsSharing::Ptr&);
+        const MKLDNNExtensionManager::Ptr&, MKLDNNWeightsSharing::Ptr&, const MultiCachePtr&);
 template void MKLDNNGraph::CreateGraph(const CNNNetwork&,
-        const MKLDNNExtensionManager::Ptr&, MKLDNNWeightsSharing::Ptr&);
+        const MKLDNNExtensionManager::Ptr&, MKLDNNWeightsSharing::Ptr&, const MultiCachePtr&);
 
 void MKLDNNGraph::Replicate(const std::shared_ptr<const ov::Model> &subgraph, const MKLDNNExtensionManager::Ptr& extMgr) {
     this->_name = "subgraph";
@@ -761,6 +761,52 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
 }
 
+void MKLDNNGraph::InitDynamicMemoryArena() {
+    // the number of the input shapes signatures the dynamic edges offsets are kept for
+    constexpr size_t dynamicMemoryPlansCapacity = 256;
+
+    // group the edges by the edge that owns the memory (must be called before the shared memory is resolved)
+    std::unordered_map<MKLDNNEdgePtr, std::vector<MKLDNNEdgePtr>> clusters;
+    std::vector<MKLDNNEdgePtr> roots;
+    for (auto& edge : graphEdges) {
+        auto root = edge;
+        while (auto sharedEdge = root->getSharedEdge(std::nothrow))
+            root = sharedEdge;
+        if (root->getStatus() != MKLDNNEdge::Status::NeedAllocation || root->hasDefinedMaxSize())
+            continue;
+        auto& cluster = clusters[root];
+        if (cluster.empty())
+            roots.push_back(root);
+        if (edge == root)
+            cluster.insert(cluster.begin(), edge);
+        else
+            cluster.push_back(edge);
+    }
+
+    for (auto& root : roots) {
+        auto& cluster = clusters[root];
+        int start = std::numeric_limits<int>::max();
+        int finish = 0;
+        bool reusable = true;
+        for (auto& edge : cluster) {
+            auto parent = edge->getParent();
+            auto child = edge->getChild();
+            // the memory of the inputs and outputs may be bound to the user blobs,
+            // while the constants and the states must keep the data between the inferences
+            reusable = reusable && !parent->isConstant() &&
+                       !one_of(parent->getType(), Input, MemoryInput) && !one_of(child->getType(), Output, MemoryOutput);
+            start = std::min(start, parent->execIndex);
+            finish = std::max(finish, child->execIndex);
+        }
+        if (!reusable)
+            continue;
+
+        if (!dynamicMemoryArena)
+            dynamicMemoryArena.reset(new DynamicMemoryArena(dynamicMemoryPlansCapacity));
+        dynamicMemoryArena->addCluster(std::move(cluster), start, finish);
+    }
+}
+
 void MKLDNNGraph::Allocate() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "MKLDNNGraph::Allocate");
 
@@ -772,6 +818,9 @@ void MKLDNNGraph::Allocate() {
     // Allocate memory space for all edges marked with NeedAllocation
     AllocateWithReuse();
 
+    // Group the edges with undefined memory size to reuse their memory between the inferences
+    InitDynamicMemoryArena();
+
     // Create dummy memory with undefined desc for edges that are need allocation but has not been allocated withing mem solver
     for (auto& edge : graphEdges) edge->allocate();
 
@@ -958,6 +1007,9 @@ void MKLDNNGraph::Infer(MKLDNNInferRequestBase* request) {
 
     mkldnn::stream stream(eng);
 
+    if (dynamicMemoryArena)
+        dynamicMemoryArena->bind(inputNodesMap);
+
     for (const auto& node : executableGraphNodes) {
         VERBOSE(node, config.verbose);
         PERF(node, config.collectPerfCounters);
@@ -967,9 +1019,53 @@ void MKLDNNGraph::Infer(MKLDNNInferRequestBase* request) {
         ExecuteNode(node, stream);
     }
 
+    if (dynamicMemoryArena)
+        dynamicMemoryArena->record();
+
     if (infer_count != -1) infer_count++;
 }
 
+void MKLDNNGraph::WarmUp(const std::vector<VectorDims>& inputDims) {
+    if (!IsReady()) {
+        IE_THROW() << "Wrong state. Topology is not ready.";
+    }
+    if (inputDims.size() != inputNodesMap.size()) {
+        IE_THROW() << "Can't warm up graph " << GetName() << ": inputs number mismatch";
+    }
+
+    auto dims = inputDims.begin();
+    for (auto& input : inputNodesMap) {
+        auto& node = input.second;
+        if (node->isDynamicNode()) {
+            node->redefineOutputMemory({*dims});
+        } else if (!node->getOutputShapeAtPort(0).isCompatible(*dims)) {
+            IE_THROW() << "Can't warm up graph " << GetName() << ": incompatible dims for input " << input.first;
+        }
+        auto& mem = node->getChildEdgeAt(0)->getMemory();
+        if (mem.GetSize() != 0)
+            std::memset(mem.GetData(), 0, mem.GetSize());
+        ++dims;
+    }
+
+    // The nodes are not executed, only the shapes are inferred and the primitives are created. The outputs are zero
+    // filled instead, so the shape inference depending on the values of the other nodes gets the same data each time.
+    for (const auto& node : executableGraphNodes) {
+        if (node->isDynamicNode())
+            node->prepareDynamic();
+        if (!node->isExecutable())
+            continue;
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto& mem = node->getChildEdgeAt(i)->getMemory();
+            if (mem.isAllocated() && mem.getDesc().isDefined() && mem.GetSize() != 0)
+                std::memset(mem.GetData(), 0, mem.GetSize());
+        }
+    }
+    // the parameters are prepared again for the data of the first inference, taking them from the cache
+    for (const auto& node : executableGraphNodes) {
+        node->resetLastInputDims();
+    }
+}
+
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
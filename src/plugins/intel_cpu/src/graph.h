@@ -11,6 +11,7 @@
 #include "node.h"
 #include "edge.h"
 #include "cache/multi_cache.h"
+#include "dynamic_memory_arena.h"
 #include <map>
 #include <string>
 #include <vector>
@@ -47,10 +48,15 @@ public:
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
+    /**
+     * @param rtCache runtime parameters cache shared with other graphs (e.g. the graphs of other streams),
+     *        a private cache is created if it is not provided
+     */
     template<typename NET>
     void CreateGraph(NET &network,
                      const MKLDNNExtensionManager::Ptr& extMgr,
-                     MKLDNNWeightsSharing::Ptr &w_cache);
+                     MKLDNNWeightsSharing::Ptr &w_cache,
+                     const MultiCachePtr& rtCache = nullptr);
 
     void CreateGraph(const std::vector<MKLDNNNodePtr> &graphNodes,
                      const std::vector<MKLDNNEdgePtr> &graphEdges,
@@ -66,6 +72,13 @@ public:
 
     void Infer(MKLDNNInferRequestBase* request = nullptr);
 
+    /**
+     * @brief Infers the shapes of the graph for zero filled inputs of the given dims without the execution, so all the
+     *        nodes prepare their runtime parameters and put them into the runtime parameters cache
+     * @param inputDims input dims ordered the same way as the input nodes map
+     */
+    void WarmUp(const std::vector<VectorDims>& inputDims);
+
     const std::vector<MKLDNNNodePtr>& GetNodes() const {
         return graphNodes;
     }
@@ -203,6 +216,7 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _normalizePreprocMap.clear();
+        dynamicMemoryArena.reset();
     }
     Status status { NotReady };
     Config config;
@@ -214,6 +228,8 @@ protected:
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    // reuses the memory of the edges with undefined size between the inferences, exists only for dynamic graphs
+    std::unique_ptr<DynamicMemoryArena> dynamicMemoryArena;
 
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
@@ -235,6 +251,7 @@ protected:
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
+    void InitDynamicMemoryArena();
     void CreatePrimitives();
     void ExtractConstantAndExecutableNodes();
     void ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::stream& stream) const;
@@ -26,6 +26,25 @@
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
 
+namespace {
+// user memory is bound to the graph edges only when it is aligned at least to the element size
+bool isAlignedToElementSize(const InferenceEngine::Blob::Ptr& blob) {
+    const auto elementSize = blob->getTensorDesc().getPrecision().size();
+    const auto address = reinterpret_cast<uintptr_t>(blob->buffer().as<void*>());
+    return elementSize <= 1 || address % elementSize == 0;
+}
+
+std::string getStateName(ov::intel_cpu::MKLDNNMemoryInputNode* node) {
+    auto state_name = node->getId();
+
+    // Remove suffix with pair ID. Internal information.
+    auto suffix_idx = state_name.find("/id=");
+    if (suffix_idx != std::string::npos)
+        state_name = state_name.substr(0, suffix_idx);
+    return state_name;
+}
+}  // namespace
+
 void ov::intel_cpu::MKLDNNInferRequestBase::CreateInferRequest() {
     auto id = (execNetwork->_numRequests)++;
     profilingTask = openvino::itt::handle("MKLDNN_INFER_" + execNetwork->_name + "_" + std::to_string(id));
@@ -45,15 +64,9 @@ void ov::intel_cpu::MKLDNNInferRequestBase::CreateInferRequest() {
             if (!memoryNode) {
                 IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
             }
-            auto state_store = memoryNode->getStore();
-            auto state_name = memoryNode->getId();
-
-            // Remove suffix with pair ID. Internal information.
-            auto suffix_idx = state_name.find("/id=");
-            if (suffix_idx != std::string::npos)
-                state_name = state_name.substr(0, suffix_idx);
+            auto state_name = getStateName(memoryNode);
 
-            memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+            memoryStates.emplace_back(new MKLDNNVariableState(state_name, memoryNode->getStoreDesc()));
         }
     }
 }
@@ -65,6 +78,7 @@ ov::intel_cpu::MKLDNNInferRequestBase::~MKLDNNInferRequestBase() {
 void ov::intel_cpu::MKLDNNInferRequestBase::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision inPrec) {
     auto& tensorDesc = inputBlob->getTensorDesc();
     bool needConvert = inPrec != tensorDesc.getPrecision();
+    auto& counters = execNetwork->_zeroCopyCounters;
 
     const void* srcData = inputBlob->cbuffer().as<const void *>();
     if (srcData == nullptr) {
@@ -86,9 +100,71 @@ void ov::intel_cpu::MKLDNNInferRequestBase::pushInput(const std::string& inputNa
         cpu_convert(srcData, dstData, tensorDesc.getPrecision(), iconv->getTensorDesc().getPrecision(), iconv->size());
     }
 
+    const auto& inputNodesMap = graph->GetInputNodesMap();
+    const auto inputNode = inputNodesMap.find(inputName);
+    if (!needConvert && inputNode != inputNodesMap.end() &&
+        inputNode->second->getChildEdgeAt(0)->getMemory().GetData() == srcData) {
+        counters.inputsZeroCopy++;
+    } else {
+        counters.inputsCopied++;
+    }
+
     graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
 }
 
+bool ov::intel_cpu::MKLDNNInferRequestBase::canBindZeroCopy(const std::string& name,
+                                                             const InferenceEngine::Blob::Ptr& blob,
+                                                             const MemoryDesc& desc) const {
+    if (graph->_normalizePreprocMap.find(name) != graph->_normalizePreprocMap.end() || graph->getProperty().batchLimit)
+        return false;
+    if (!isAlignedToElementSize(blob))
+        return false;
+    const auto& tensorDesc = blob->getTensorDesc();
+    if (!desc.isDefined() || tensorDesc.getLayout() == InferenceEngine::Layout::ANY)
+        return false;
+    return desc.isCompatible(MemoryDescUtils::convertToCpuBlockedMemoryDesc(tensorDesc));
+}
+
+void ov::intel_cpu::MKLDNNInferRequestBase::bindDynamicInput(const std::string& name,
+                                                              const MKLDNNNodePtr& inputNode,
+                                                              const InferenceEngine::Blob::Ptr& blob) {
+    auto boundPtr = externalPtr.find(name);
+    if (canBindZeroCopy(name, blob, inputNode->getChildEdgeAt(0)->getMemory().getDesc())) {
+        // the user memory is bound to the edges in changeDefaultPtr
+        externalPtr[name] = blob->buffer();
+        return;
+    }
+    if (boundPtr == externalPtr.end())
+        return;
+    // the edges still refer to the user memory of the previous inference, that may be already released,
+    // so the edges get their own memory back
+    for (auto& edge : inputNode->getChildEdges()) {
+        auto e = edge.lock();
+        if (!e)
+            IE_THROW() << "Node " << inputNode->getName() << " contains empty child edge";
+        auto& memory = e->getMemoryPtr();
+        if (memory->GetData() == boundPtr->second) {
+            memory->getDnnlMemoryMngr()->setExtBuff(nullptr, 0);
+            memory->redefineDesc(memory->getDescPtr());
+        }
+    }
+    externalPtr.erase(boundPtr);
+}
+
+void ov::intel_cpu::MKLDNNInferRequestBase::updateZeroCopyCounters() {
+    auto& counters = execNetwork->_zeroCopyCounters;
+    const auto& outputNodesMap = graph->GetOutputNodesMap();
+    for (const auto& output : _outputs) {
+        const auto outputNode = outputNodesMap.find(output.first);
+        if (outputNode == outputNodesMap.end())
+            continue;
+        if (outputNode->second->getParentEdgeAt(0)->getMemory().GetData() == output.second->cbuffer().as<const void*>())
+            counters.outputsZeroCopy++;
+        else
+            counters.outputsCopied++;
+    }
+}
+
 void ov::intel_cpu::MKLDNNInferRequestBase::PushStates() {
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
@@ -96,21 +172,34 @@ void ov::intel_cpu::MKLDNNInferRequestBase::PushStates() {
             if (!cur_node) {
                 IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
             }
-            auto cur_id = cur_node->getId();
+            auto cur_id = getStateName(cur_node);
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+                    auto cur_state = std::dynamic_pointer_cast<MKLDNNVariableState>(state);
+                    if (!cur_state) {
+                        IE_THROW() << "Cannot cast the state " << cur_id << " to MKLDNNVariableState";
+                    }
+                    if (!cur_state->isAttached()) {
+                        IE_THROW() << "The state " << cur_id << " is detached from the infer request";
+                    }
+                    // the graph is shared by the requests, so the node reads and writes the buffers of this request
+                    cur_node->bindState(cur_state->getCurrent(), cur_state->getNext());
                 }
             }
         }
     }
 }
 
+void ov::intel_cpu::MKLDNNInferRequestBase::UnbindStates() {
+    for (auto &node : graph->GetNodes()) {
+        if (node->getType() == MemoryInput) {
+            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+            if (cur_node)
+                cur_node->unbindState();
+        }
+    }
+}
+
 void ov::intel_cpu::MKLDNNInferRequestBase::PullStates() {
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
@@ -118,15 +207,14 @@ void ov::intel_cpu::MKLDNNInferRequestBase::PullStates() {
             if (!cur_node) {
                 IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
             }
-            auto cur_id = cur_node->getId();
+            // the state buffers may be released (or detached) together with the request
+            cur_node->unbindState();
+            if (!cur_node->isStateAssigned())
+                continue;
+            auto cur_id = getStateName(cur_node);
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                    std::static_pointer_cast<MKLDNNVariableState>(state)->commit();
                 }
             }
         }
@@ -142,10 +230,29 @@ void ov::intel_cpu::MKLDNNInferRequestBase::redefineMemoryForInputNodes() {
             IE_THROW() << "CPU execution graph doesn't contain input node with name: " << blob.first;
         if (inputNode->second->isDynamicNode()) {
             inputNode->second->redefineOutputMemory({blob.second->getTensorDesc().getDims()});
+            bindDynamicInput(blob.first, inputNode->second, blob.second);
         }
     }
 }
 
+void ov::intel_cpu::MKLDNNInferRequestBase::recordInputShapes() {
+    // the history is shared between the requests, so it is accessed only on the shapes new for the request
+    const auto& history = execNetwork->_inputShapesHistory;
+    if (recordedInputShapes.size() >= history->getCapacity())
+        return;
+    InputShapesHistory::Signature signature;
+    const auto& cpuInputNodes = graph->GetInputNodesMap();
+    signature.reserve(cpuInputNodes.size());
+    for (const auto& input : cpuInputNodes) {
+        const auto blob = _inputs.find(input.first);
+        if (blob == _inputs.end())
+            return;
+        signature.push_back(blob->second->getTensorDesc().getDims());
+    }
+    if (recordedInputShapes.insert(signature).second)
+        history->record(signature);
+}
+
 void ov::intel_cpu::MKLDNNInferRequestBase::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, profilingTask);
@@ -156,6 +263,9 @@ void ov::intel_cpu::MKLDNNInferRequestBase::InferImpl() {
 
     if (graph->hasDynamicInput()) {
         redefineMemoryForInputNodes();
+        if (execNetwork->_inputShapesHistory) {
+            recordInputShapes();
+        }
     } else if (graph->getProperty().isNewApi && graph->getProperty().batchLimit > 0) {
         const auto batch = _inputs.begin()->second->getTensorDesc().getDims()[0];
         SetBatch(batch);
@@ -170,17 +280,23 @@ void ov::intel_cpu::MKLDNNInferRequestBase::InferImpl() {
     PushInputData();
 
     if (memoryStates.size() != 0) {
-        PushStates();
-    }
-
-    graph->Infer(this);
-
-    if (memoryStates.size() != 0) {
+        try {
+            PushStates();
+            graph->Infer(this);
+        } catch (...) {
+            // the new state (if any) is discarded, but the nodes must not refer to the buffers of this request
+            UnbindStates();
+            throw;
+        }
         PullStates();
+    } else {
+        graph->Infer(this);
     }
 
     ThrowIfCanceled();
 
+    updateZeroCopyCounters();
+
     graph->PullOutputData(_outputs);
 }
 
@@ -432,7 +548,7 @@ void ov::intel_cpu::MKLDNNLegacyInferRequest::SetBlob(const std::string& name, c
                 IE_THROW() << "Blob returned after trying to interpret input node's memory is nullable. Input node name: " << name;
             }
 
-            if (data->getTensorDesc() == pBlob->getTensorDesc() &&
+            if (data->getTensorDesc() == pBlob->getTensorDesc() && isAlignedToElementSize(data) &&
                 graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
                 externalPtr[name] = data->buffer();
             } else if (externalPtr.find(name) != externalPtr.end()) {
@@ -469,7 +585,7 @@ void ov::intel_cpu::MKLDNNLegacyInferRequest::SetBlob(const std::string& name, c
         if (!pBlob)
             IE_THROW() << "Blob returned after trying to interpret output node's memory is nullable. Output node name: " << name;
 
-        if (data->getTensorDesc() == pBlob->getTensorDesc() &&
+        if (data->getTensorDesc() == pBlob->getTensorDesc() && isAlignedToElementSize(data) &&
                 !graph->getProperty().batchLimit) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
@@ -705,18 +821,11 @@ void ov::intel_cpu::MKLDNNInferRequest::SetBlob(const std::string& name, const I
             IE_THROW() << "Can't SetBlob with name: " << name << ", because model input and blob have different size";
         }
 
+        // for the dynamic input the binding is decided on inference, when the input memory is redefined
         MemoryDescPtr actualDesc = graph->getInputNodeByName(name)->getBaseMemDescAtOutputPort(0);
-        if (!actualDesc->isDefined()) {
-            // we must define desc for dynamic case
-            // otherwise we got incorrect check on shape compatibility inside isCompatible
-            // because lower and upper bound will be compared
-            actualDesc = actualDesc->cloneWithNewDims(blobDesc.getLayout() == InferenceEngine::Layout::SCALAR ? InferenceEngine::SizeVector{1} :
-                                                                                                                blobDesc.getDims());
-        }
-        if (actualDesc->isCompatible(MemoryDescUtils::convertToCpuBlockedMemoryDesc(blobDesc)) &&
-                graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
+        if (!isDynamic && canBindZeroCopy(name, data, *actualDesc)) {
             externalPtr[name] = data->buffer();
-        } else if (externalPtr.find(name) != externalPtr.end()) {
+        } else if (!isDynamic && externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
         }
         _inputs[name] = data;
@@ -742,7 +851,8 @@ void ov::intel_cpu::MKLDNNInferRequest::SetBlob(const std::string& name, const I
         }
 
         const auto &desc = graph->getOutputNodeByName(name)->getParentEdgesAtPort(0)[0]->getMemory().getDesc();
-        if (!isDynamic && blobDesc == MemoryDescUtils::convertToTensorDesc(desc) && !graph->getProperty().batchLimit) {
+        if (!isDynamic && blobDesc == MemoryDescUtils::convertToTensorDesc(desc) && isAlignedToElementSize(data) &&
+                !graph->getProperty().batchLimit) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <set>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 
 namespace ov {
@@ -16,6 +17,16 @@ namespace intel_cpu {
 class MKLDNNExecNetwork;
 class MKLDNNAsyncInferRequest;
 
+/**
+ * @brief Zero-copy contract: the user input blob (or static output blob) is bound to the graph memory directly, so
+ * it is neither copied in PushInputData nor in PullOutputData, when all of the following holds:
+ *  - its precision, layout and strides match the memory descriptor of the corresponding graph edge
+ *  - its data is aligned to the element size
+ *  - no mean image preprocessing and no legacy dynamic batch is used for it
+ *  - the graph does not change the edge memory in-place (e.g. optimized Concat/Split as the consumer)
+ * For the dynamic inputs the binding is re-evaluated for every inference, once the shape is known.
+ * The numbers of the zero-copy and copied inputs/outputs are reported via CPU_ZERO_COPY_STATISTICS metric
+ */
 class MKLDNNInferRequestBase : public InferenceEngine::IInferRequestInternal {
 public:
     virtual ~MKLDNNInferRequestBase();
@@ -49,6 +60,7 @@ protected:
     : IInferRequestInternal(inputs, outputs), execNetwork(execNetwork_) {}
 
     void CreateInferRequest();
+    bool canBindZeroCopy(const std::string& name, const InferenceEngine::Blob::Ptr& blob, const MemoryDesc& desc) const;
     InferenceEngine::Precision normToInputSupportedPrec(const std::pair<const std::string, InferenceEngine::Blob::Ptr>& input) const;
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
@@ -61,13 +73,19 @@ protected:
 private:
     void PushStates();
     void PullStates();
+    void UnbindStates();
     void redefineMemoryForInputNodes();
+    void recordInputShapes();
+    void bindDynamicInput(const std::string& name, const MKLDNNNodePtr& inputNode, const InferenceEngine::Blob::Ptr& blob);
+    void updateZeroCopyCounters();
 
     void changeDefaultPtr();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
+    // input shapes already passed to the network history by this request
+    std::set<InputShapesHistory::Signature> recordedInputShapes;
 };
 
 class MKLDNNLegacyInferRequest : public MKLDNNInferRequestBase {
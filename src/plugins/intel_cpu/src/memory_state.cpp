@@ -11,10 +11,67 @@ using namespace InferenceEngine;
 namespace ov {
 namespace intel_cpu {
 
+void MKLDNNVariableState::checkAttached() const {
+    if (!isAttached())
+        IE_THROW() << "The state " << GetName() << " is detached from the infer request";
+}
+
 void  MKLDNNVariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+    checkAttached();
+    std::memset(getCurrent(), 0, state->byteSize());
+}
+
+void MKLDNNVariableState::SetState(const Blob::Ptr& newState) {
+    checkAttached();
+    if (!newState)
+        IE_THROW() << "Cannot set an empty blob to the state " << GetName();
+    if (newState->byteSize() != state->byteSize())
+        IE_THROW() << "Cannot set the state " << GetName() << ": the blob size " << newState->byteSize()
+                   << " doesn't match the state size " << state->byteSize();
+
+    cpu_memcpy(getCurrent(), newState->cbuffer().as<const void*>(), state->byteSize());
+}
+
+Blob::CPtr MKLDNNVariableState::GetState() const {
+    checkAttached();
+    // the current buffer is written by the inference after the next one, so the state is copied
+    auto copy = make_blob_with_precision(state->getTensorDesc());
+    copy->allocate();
+    cpu_memcpy(copy->buffer().as<void*>(), getCurrent(), state->byteSize());
+    return copy;
+}
+
+Blob::Ptr MKLDNNVariableState::Detach() {
+    checkAttached();
+    // the graph nodes refer to the state buffers only during the inference (they are bound back to the node
+    // memory in PullStates), so once detached, the blob is not referenced by the plugin anymore
+    auto detached = buffers[current];
+    buffers[current] = nullptr;
+    state = nullptr;
+    return detached;
+}
+
+void MKLDNNVariableState::Attach(const Blob::Ptr& newState) {
+    // the other buffer is always owned by the state
+    const auto& desc = buffers[current ^ 1]->getTensorDesc();
+    if (!newState)
+        IE_THROW() << "Cannot attach an empty blob to the state " << GetName();
+    const auto& newDesc = newState->getTensorDesc();
+    if (newDesc.getPrecision() != desc.getPrecision() || newDesc.getDims() != desc.getDims() ||
+        newDesc.getBlockingDesc() != desc.getBlockingDesc())
+        IE_THROW() << "Cannot attach the blob to the state " << GetName()
+                   << ": the blob precision, shape or layout doesn't match the state";
+    auto memoryBlob = as<MemoryBlob>(newState);
+    if (!memoryBlob)
+        IE_THROW() << "Cannot attach the blob to the state " << GetName() << ": the blob is not a memory blob";
+    const auto address = reinterpret_cast<uintptr_t>(memoryBlob->rmap().as<const void*>());
+    if (address % desc.getPrecision().size() != 0)
+        IE_THROW() << "Cannot attach the blob to the state " << GetName()
+                   << ": the blob memory is not aligned to the element size";
+
+    buffers[current] = newState;
+    state = newState;
 }
 
 }   // namespace intel_cpu
 }   // namespace ov
-
@@ -10,21 +10,66 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
+#include <array>
+#include <cstring>
 #include <string>
 
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief The state keeps two buffers: the current one is read by ReadValue, while Assign writes
+ * the new state to the other one. The buffers are swapped after the inference, so the state is
+ * passed between the inferences without copying.
+ * The current buffer can be detached and replaced by the user blob, so the sessions kept by the user
+ * are switched without copying as well.
+ */
 class MKLDNNVariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
+    /**
+     * @brief Creates the state of the `desc` layout, initialized with zeros (the default value of the state)
+     */
+    MKLDNNVariableState(std::string name, const MemoryDesc& desc) :
             InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
+        for (auto& buffer : buffers) {
+            buffer = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(desc));
+            buffer->allocate();
+        }
+        state = buffers[current];
+        std::memset(getCurrent(), 0, state->byteSize());
     }
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    /**
+     * @brief Returns a copy of the current state, the double buffering doesn't leak to the user
+     */
+    InferenceEngine::Blob::CPtr GetState() const override;
+    InferenceEngine::Blob::Ptr Detach() override;
+    void Attach(const InferenceEngine::Blob::Ptr& newState) override;
+
+    bool isAttached() const {
+        return buffers[current] != nullptr;
+    }
+    void* getCurrent() const {
+        return buffers[current]->buffer().as<void*>();
+    }
+    void* getNext() const {
+        return buffers[current ^ 1]->buffer().as<void*>();
+    }
+    /**
+     * @brief Makes the state written by the last inference current
+     */
+    void commit() {
+        current ^= 1;
+        state = buffers[current];
+    }
+
+private:
+    void checkAttached() const;
+
+    std::array<InferenceEngine::Blob::Ptr, 2> buffers;
+    size_t current = 0;
 };
 
 }   // namespace intel_cpu
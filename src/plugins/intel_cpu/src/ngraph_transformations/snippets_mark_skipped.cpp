@@ -145,10 +145,12 @@ bool isSuitableMiscParent(const std::shared_ptr<const Node> &node) {
                                   ov::is_type<ngraph::op::util::ArithmeticReductionKeepDims>(node) ||
                                   ov::is_type<ngraph::op::util::LogicalReductionKeepDims>(node) ||
                                   ov::is_type<ngraph::opset1::GroupConvolutionBackpropData>(node);
+    // the reductions over the least varying dimension are fused with their eltwise children by snippets
+    const bool is_snippets_row_reduction = snippets::pass::IsRowReduction(node) && snippets::pass::AppropriateForSubgraph(node);
     // has a single output, connected to a single child
     const auto out = node->outputs();
     const bool has_only_child = (out.size() == 1) && (out[0].get_target_inputs().size() == 1);
-    return is_suitable_node && has_only_child;
+    return is_suitable_node && !is_snippets_row_reduction && has_only_child;
 }
 // Matmul is a special case, since it supports simple + bias fusings
 bool isSuitableMatMulParent(const std::shared_ptr<const Node> &node) {
@@ -527,6 +527,18 @@ void MKLDNNNode::executeDynamic(mkldnn::stream strm) {
     updateLastInputDims();
 }
 
+void MKLDNNNode::prepareDynamic() {
+    if (needShapeInfer()) {
+        redefineOutputMemory(shapeInfer());
+    }
+    if (isExecutable() && needPrepareParams()) {
+        IE_ASSERT(inputShapesDefined()) << "Can't prepare params for " << getTypeStr() << " node with name: " << getName() <<
+            " since the input shapes are not defined.";
+        prepareParams();
+    }
+    updateLastInputDims();
+}
+
 void MKLDNNNode::redefineOutputMemory(const std::vector<VectorDims> &newOutputShapes) {
     if (newOutputShapes.size() != outputShapes.size()) {
         IE_THROW() << "Number shapes mismatch with real outputs number for node with name: " << getName();
@@ -331,7 +331,18 @@ public:
 
     virtual void execute(mkldnn::stream strm);
     void executeDynamic(mkldnn::stream strm);
+    /**
+     * @brief Performs the shape inference and the parameters preparation of the dynamic execution without the execution
+     */
+    void prepareDynamic();
     virtual void redefineOutputMemory(const std::vector<VectorDims> &newShapes);
+    /**
+     * @brief Forces the parameters preparation on the next dynamic execution even if the input shapes are the same.
+     * Must be called when the memory of the node edges is rebound, since the parameters may refer to the data pointers
+     */
+    void resetLastInputDims() {
+        lastInputDims.clear();
+    }
 
     virtual void initSupportedPrimitiveDescriptors();
 
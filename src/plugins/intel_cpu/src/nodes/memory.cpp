@@ -103,7 +103,9 @@ bool MKLDNNMemoryInputNode::isSupportedOperation(const std::shared_ptr<const ngr
 }
 
 MKLDNNMemoryInputNode::MKLDNNMemoryInputNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
-        : MKLDNNInputNode(op, eng, cache), MKLDNNMemoryNode(op), dataStore(new MKLDNNMemory{eng}) {
+        : MKLDNNInputNode(op, eng, cache), MKLDNNMemoryNode(op),
+          dataStore(new MKLDNNMemory{eng}), assignStore(new MKLDNNMemory{eng}),
+          ownDataStore(new MKLDNNMemory{eng}), ownAssignStore(new MKLDNNMemory{eng}) {
     std::string errorMessage;
     if (!isSupportedOperation(op, errorMessage)) {
         IE_THROW(NotImplemented) << errorMessage;
@@ -116,11 +118,15 @@ MKLDNNMemoryInputNode::MKLDNNMemoryInputNode(const std::shared_ptr<ngraph::Node>
 void MKLDNNMemoryInputNode::createPrimitive() {
     MKLDNNInputNode::createPrimitive();
 
-    dataStore->Create(getChildEdgeAt(0)->getMemory().getDesc());
+    ownDataStore->Create(getChildEdgeAt(0)->getMemory().getDesc());
+    ownAssignStore->Create(ownDataStore->getDesc());
 
     // default memory state is zero filled
-    if (dataStore->getDesc().hasDefinedMaxSize())
-        dataStore->FillZero();
+    if (ownDataStore->getDesc().hasDefinedMaxSize())
+        ownDataStore->FillZero();
+
+    dataStore->Create(ownDataStore->getDesc(), ownDataStore->GetData());
+    assignStore->Create(ownAssignStore->getDesc(), ownAssignStore->GetData());
 }
 
 /**
@@ -145,15 +151,26 @@ MKLDNNMemoryInputNode::~MKLDNNMemoryInputNode() {
     MKLDNNMemoryNodeVirtualEdge::remove(this, holder);
 }
 
-MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
-    return dataStore;
+const MemoryDesc& MKLDNNMemoryInputNode::getStoreDesc() const {
+    return dataStore->getDesc();
+}
+
+void MKLDNNMemoryInputNode::bindState(void* current, void* next) {
+    dataStore->setDataHandle(current);
+    assignStore->setDataHandle(next);
+    stateAssigned = false;
+}
+
+void MKLDNNMemoryInputNode::unbindState() {
+    dataStore->setDataHandle(ownDataStore->GetData());
+    assignStore->setDataHandle(ownAssignStore->GetData());
 }
 
 void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
-    // TODO: Should be next one call:
-    //           dataStore.SetData(new_state, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    // the new state is written to the other buffer, so it doesn't depend on
+    // whether the ReadValue has been already executed in this inference
+    simple_copy(*assignStore, new_state);
+    stateAssigned = true;
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
@@ -99,9 +99,30 @@ public:
 
     void setInputNode(MKLDNNNode* node) override {}
     void storeState(const MKLDNNMemory& mem);
-    MKLDNNMemoryPtr getStore();
+    const MemoryDesc& getStoreDesc() const;
+    /**
+     * @brief Binds the node to the buffers of the state: the current state is read from the first one,
+     * the new state is written to the second one
+     */
+    void bindState(void* current, void* next);
+    /**
+     * @brief Binds the node back to its own buffers, so the node doesn't refer to the memory of the request
+     * once the inference is over
+     */
+    void unbindState();
+    /**
+     * @brief Returns true if the new state was written since the last bindState call
+     */
+    bool isStateAssigned() const {
+        return stateAssigned;
+    }
  private:
     MKLDNNMemoryPtr dataStore;
+    MKLDNNMemoryPtr assignStore;
+    // the buffers of the node, the stores above are bound to when no inference is running
+    MKLDNNMemoryPtr ownDataStore;
+    MKLDNNMemoryPtr ownAssignStore;
+    bool stateAssigned = false;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
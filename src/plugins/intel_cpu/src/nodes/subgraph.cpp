@@ -22,6 +22,7 @@
 #include <ie_ngraph_utils.hpp>
 
 #include <snippets/op/subgraph.hpp>
+#include <common/primitive_hashing_utils.hpp>
 #include "emitters/cpu_generator.hpp"
 
 using namespace ov::intel_cpu;
@@ -36,29 +37,54 @@ MKLDNNSnippetNode::MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, co
     host_isa = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_common) ?
         dnnl::impl::cpu::x64::avx512_common : dnnl::impl::cpu::x64::avx2;
 
-    // Create a deep local copy of the input snippet to perform canonicalization & code generation
-    // Todo: Probably better to implement a proper copy constructor
     if (const auto tmp_snippet =  ov::as_type_ptr<ngraph::snippets::op::Subgraph>(op)) {
-        ngraph::OutputVector subgraph_node_inputs;
-        for (const auto &input : tmp_snippet->input_values()) {
-            auto new_input = std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
-            subgraph_node_inputs.push_back(new_input);
-        }
-        auto new_body = ov::clone_model(*tmp_snippet->get_body().get());
-        snippet = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
-        ngraph::copy_runtime_info(tmp_snippet, snippet);
-        snippet->set_friendly_name(tmp_snippet->get_friendly_name());
-        snippet->set_generator(std::make_shared<CPUGenerator>(host_isa));
+        snippet = copy_snippet(tmp_snippet);
     } else {
         IE_THROW(NotImplemented) << "Node is not an instance of snippets::op::Subgraph";
     }
 }
 
+std::shared_ptr<ngraph::snippets::op::Subgraph> MKLDNNSnippetNode::copy_snippet(const std::shared_ptr<ngraph::snippets::op::Subgraph>& original) const {
+    // Create a deep local copy of the input snippet to perform canonicalization & code generation
+    // Todo: Probably better to implement a proper copy constructor
+    ngraph::OutputVector subgraph_node_inputs;
+    for (const auto &input : original->input_values()) {
+        auto new_input = std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
+        subgraph_node_inputs.push_back(new_input);
+    }
+    auto new_body = ov::clone_model(*original->get_body().get());
+    auto copy = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
+    ngraph::copy_runtime_info(original, copy);
+    copy->set_friendly_name(original->get_friendly_name());
+    copy->set_generator(std::make_shared<CPUGenerator>(host_isa));
+    return copy;
+}
+
+size_t MKLDNNSnippetNode::ShapesKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    for (const auto& d : dims)
+        seed = get_vector_hash(seed, d);
+    return seed;
+}
+
+bool MKLDNNSnippetNode::ShapesKey::operator==(const ShapesKey& rhs) const {
+    return dims == rhs.dims;
+}
+
 void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
-    const Precision supportedPrecision = Precision::FP32;
+    // The kernel computes in fp32, the other precisions are converted on the loads and stores
+    auto getSupportedPrecision = [](Precision prc, bool isOutput) -> Precision {
+        // the conversion to bf16 is supported by jit_store_emitter only starting from avx512_core
+        if (prc == Precision::BF16 && isOutput && !mayiuse(x64::avx512_core))
+            return Precision::FP32;
+        return one_of(prc, Precision::FP32, Precision::BF16, Precision::I8, Precision::U8) ? prc : Precision::FP32;
+    };
 
     bool dimRanksAreEqual = true;
     for (size_t i = 0; dimRanksAreEqual && i < inputShapes.size(); i++) {
@@ -69,11 +95,13 @@ void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
     }
 
     const size_t ndims = outputShapes[0].getRank();
-    const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1, 2, 4, 5) && dimRanksAreEqual;
+    // The row reductions run over the least varying dimension of the planar layout
+    const bool hasRowReductions = snippet->has_row_reductions();
+    const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1, 2, 4, 5) && dimRanksAreEqual && !hasRowReductions;
     // Todo: Snippets currently don't support per-channel broadcasting of Blocked descriptors because
     //  canonicalization can't distinguish between <N, C, H, W, c> and <N, C, D, H, W> cases.
     //  See snippets::op::Subgraph::canonicalize for details.
-    const bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  4, 5) && dimRanksAreEqual;
+    const bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  4, 5) && dimRanksAreEqual && !hasRowReductions;
     enum LayoutType {
         Planar,
         ChannelsFirst,
@@ -130,7 +158,8 @@ void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
             if (inputShapes[i].getDims()[0] == 1) {
                 inputMask.reset(0); // accepts any stride on batch axis
             }
-            portConfig.setMemDesc(createMemoryDesc(inputShapes[i], supportedPrecision, offset), inputMask);
+            const auto precision = getSupportedPrecision(getOriginalInputPrecisionAtPort(i), false);
+            portConfig.setMemDesc(createMemoryDesc(inputShapes[i], precision, offset), inputMask);
             config.inConfs[i] = portConfig;
         }
         config.outConfs.resize(outputShapes.size());
@@ -142,7 +171,8 @@ void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
             if (outputShapes[i].getDims()[0] == 1) {
                 outputMask.reset(0); // accepts any stride on batch axis
             }
-            portConfig.setMemDesc(createMemoryDesc(outputShapes[i], supportedPrecision, offset), outputMask);
+            const auto precision = getSupportedPrecision(getOriginalOutputPrecisionAtPort(i), true);
+            portConfig.setMemDesc(createMemoryDesc(outputShapes[i], precision, offset), outputMask);
             config.outConfs[i] = portConfig;
         }
 
@@ -167,23 +197,84 @@ void MKLDNNSnippetNode::selectOptimalPrimitiveDescriptor() {
 }
 
 void MKLDNNSnippetNode::createPrimitive() {
+    // the kernels of the dynamic node are generated for the actual shapes in prepareParams()
+    if (isDynamicNode()) {
+        if (shapesDefined())
+            MKLDNNNode::createPrimitive();
+        return;
+    }
+
     // schedule definition part
     // it defines offsets, strides and sizes for snippet kernel scheduling
-    define_schedule();
+    define_schedule(snippet);
+    init_start_offsets();
 
     // code generation part
     // it might be worth to generate explicitly for scheduler work amount for now,
     // but in future some interface should be defined in order to communicate schedule for a kernel
     // or generate schedule for a kernel.
     // Here kernel is generated for most warying dimension by default.
-    generate();
+    schedule = generate(snippet, false);
+}
+
+void MKLDNNSnippetNode::prepareParams() {
+    ShapesKey key;
+    for (size_t i = 0; i < inputShapes.size(); i++)
+        key.dims.push_back(getParentEdgeAt(i)->getMemory().GetDescWithType<BlockedMemoryDesc>()->getBlockDims());
+
+    auto dynamicSchedule = schedulesCache.get(key);
+    if (!dynamicSchedule) {
+        dynamicSchedule = create_dynamic_schedule();
+        schedulesCache.put(key, dynamicSchedule);
+    }
+    exec_domain = dynamicSchedule->exec_domain;
+    tensorRank = exec_domain.size();
+    schedulerWorkAmount = dynamicSchedule->schedulerWorkAmount;
+    callArgs = dynamicSchedule->callArgs;
+    schedule = dynamicSchedule->snippetKernel->schedule;
+    init_start_offsets();
+}
+
+MKLDNNSnippetNode::DynamicSchedulePtr MKLDNNSnippetNode::create_dynamic_schedule() {
+    // the snippet is kept intact, so it can be canonicalized for the other shapes later
+    const auto subgraph = copy_snippet(snippet);
+    define_schedule(subgraph);
+
+    // The canonicalized shapes affect the generated code only through the broadcasting (the inserted broadcasts,
+    // the broadcast and scalar loads and stores), so the kernel is reused for the shapes with the same pattern
+    std::vector<bool> broadcastingPattern;
+    const auto& body = subgraph->get_body();
+    for (const auto& param : body->get_parameters()) {
+        for (const auto d : param->get_shape())
+            broadcastingPattern.push_back(d == 1);
+    }
+    for (size_t i = 0; i < body->get_output_size(); i++) {
+        for (const auto d : body->get_output_shape(i))
+            broadcastingPattern.push_back(d == 1);
+    }
+    auto& snippetKernel = kernels[broadcastingPattern];
+    if (!snippetKernel) {
+        auto newKernel = std::make_shared<SnippetKernel>();
+        newKernel->schedule = generate(subgraph, true);
+        newKernel->snippet = subgraph;
+        snippetKernel = newKernel;
+    }
+
+    auto dynamicSchedule = std::make_shared<DynamicSchedule>();
+    dynamicSchedule->exec_domain = exec_domain;
+    dynamicSchedule->schedulerWorkAmount = schedulerWorkAmount;
+    fill_scheduling_args(dynamicSchedule->callArgs.scheduler_dims, dynamicSchedule->callArgs.scheduler_offsets,
+                         dynamicSchedule->callArgs.data_offsets);
+    dynamicSchedule->snippetKernel = snippetKernel;
+    return dynamicSchedule;
 }
 
 void MKLDNNSnippetNode::execute(dnnl::stream strm) {
     if (schedule.ptr == nullptr || !canUseOptimizedImpl) {
         IE_THROW() << "MKLDNNSnippetNode can't use Optimized implementation and can't fallback to reference";
     }
-    jit_snippets_call_args call_args;
+    // the scheduling info is set for the dynamic node only
+    jit_snippets_call_args call_args = callArgs;
     for (size_t i = 0; i < srcMemPtrs.size(); i++)
         call_args.src_ptrs[i] = reinterpret_cast<const uint8_t*>(srcMemPtrs[i]->GetData()) + start_offset_in[i];
 
@@ -197,6 +288,10 @@ void MKLDNNSnippetNode::execute(dnnl::stream strm) {
     }
 }
 
+void MKLDNNSnippetNode::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
 bool MKLDNNSnippetNode::created() const {
     return getType() == Subgraph;
 }
@@ -205,6 +300,14 @@ bool MKLDNNSnippetNode::canBeInPlace() const {
     if (getParentEdgesAtPort(0)[0]->getParent()->getType() == Input) {
         return false;
     }
+    // the first input of the dynamic node may be broadcasted at runtime
+    if (isDynamicNode()) {
+        return false;
+    }
+    // the row passes read the inputs again after the outputs of the previous passes are written
+    if (snippet->has_row_reductions()) {
+        return false;
+    }
 
     for (auto& parentEdge : getParentEdges()) {
         auto parent = parentEdge.lock()->getParent();
@@ -247,7 +350,7 @@ static auto collapseLastDims(std::vector<size_t>& dims, size_t dimsToCollapse) -
     }
 }
 
-void MKLDNNSnippetNode::define_schedule() {
+void MKLDNNSnippetNode::define_schedule(const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph) {
     auto edgeToBlockedShape = [](const MKLDNNEdgePtr& edge) {
         const auto blockedDesc = edge->getMemory().GetDescWithType<BlockedMemoryDesc>();
         ngraph::Shape shape(blockedDesc->getBlockDims());
@@ -269,13 +372,17 @@ void MKLDNNSnippetNode::define_schedule() {
     ngraph::snippets::op::Subgraph::BlockedShapeVector output_blocked_shapes;
     for (size_t i = 0; i < outputShapes.size(); i++)
         output_blocked_shapes.push_back(edgeToBlockedShape(getChildEdgesAtPort(i)[0]));
-    exec_domain = snippet->canonicalize(output_blocked_shapes, input_blocked_shapes);
+    exec_domain = subgraph->canonicalize(output_blocked_shapes, input_blocked_shapes);
     // initialize by maximum output dimension. Dimensions of outputs should be broadcastable
     tensorRank = std::max(static_cast<size_t>(rank6D), exec_domain.size());
     // Canonicalization broadcasts inputs and outputs to max input rank, which can be smaller than tensorRank
     // prepend to enable 6D scheduler
     exec_domain = prependWithOnes(exec_domain);
-    const auto &body = snippet->get_body();
+    // the schedule may be redefined for the new shapes of the dynamic node
+    tileRank = 1;
+    dims_in.clear();
+    dims_out.clear();
+    const auto &body = subgraph->get_body();
     for (const auto& p : body->get_parameters()) {
         dims_in.emplace_back(prependWithOnes(p->get_shape()));
     }
@@ -285,8 +392,12 @@ void MKLDNNSnippetNode::define_schedule() {
     }
 
     const auto config = getSelectedPrimitiveDescriptor()->getConfig();
-    const auto dataSize = config.inConfs[0].getMemDesc()->getPrecision().size();
-    auto initOffsets = [this, config, dataSize]() {
+    dataSize.clear();
+    for (const auto& portConfig : config.inConfs)
+        dataSize.push_back(portConfig.getMemDesc()->getPrecision().size());
+    for (const auto& portConfig : config.outConfs)
+        dataSize.push_back(portConfig.getMemDesc()->getPrecision().size());
+    auto initOffsets = [this, config]() {
         // find max rank input among all outputs
         const size_t inputNum = getParentEdges().size();
         offsets_in.resize(inputNum);
@@ -294,38 +405,23 @@ void MKLDNNSnippetNode::define_schedule() {
             offsets_in[i].resize(tensorRank, 1);
             offset_calculation(offsets_in[i], dims_in[i], exec_domain);
             for (size_t j = 0; j < tensorRank; j++) {
-                offsets_in[i][j] *= dataSize;
+                offsets_in[i][j] *= dataSize[i];
             }
         }
 
-        start_offset_in.resize(inputNum);
-        srcMemPtrs.resize(inputNum);
-        for (size_t i = 0; i < inputNum; i++) {
-            const auto memPtr = getParentEdgeAt(i)->getMemoryPtr();
-            srcMemPtrs[i] = memPtr;
-            start_offset_in[i] =  memPtr->GetDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSize;
-        }
-
         const size_t outputNum = config.outConfs.size();
         offsets_out.resize(outputNum);
         for (size_t i = 0; i < outputNum; i++) {
             offsets_out[i].resize(tensorRank, 1);
             offset_calculation(offsets_out[i], dims_out[i], exec_domain);
             for (size_t j = 0; j < tensorRank; j++) {
-                offsets_out[i][j] *= dataSize;
+                offsets_out[i][j] *= dataSize[inputNum + i];
             }
         }
-
-        start_offset_out.resize(outputNum);
-        dstMemPtrs.resize(outputNum);
-        for (size_t i = 0; i < outputNum; i++) {
-            const auto memPtr = getChildEdgeAt(i)->getMemoryPtr();
-            dstMemPtrs[i] = memPtr;
-            start_offset_out[i] = memPtr->GetDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSize;
-        }
     };
 
-    auto find_dims_to_collapse = [this, config]() -> int {
+    const bool hasRowReductions = subgraph->has_row_reductions();
+    auto find_dims_to_collapse = [this, config, hasRowReductions]() -> int {
         int collapsedDims = 0;
         size_t minimalConcurrency = parallel_get_max_threads();
         size_t minimalJitWorkAmount = 256;
@@ -334,8 +430,9 @@ void MKLDNNSnippetNode::define_schedule() {
             if (static_cast<int>(exec_domain.size()) - collapsedDims - 2 < 0)
                 break;
 
-            bool canCollapse = true;
-            for (size_t i = 0; i < dims_in.size(); i++) {
+            // the rows of the reductions can't be merged
+            bool canCollapse = !hasRowReductions;
+            for (size_t i = 0; canCollapse && i < dims_in.size(); i++) {
                 if ((dims_in[i][dims_in[i].size() - 2] != 1 && dims_in[i][dims_in[i].size() - 1] == 1) ||
                     (dims_in[i][dims_in[i].size() - 2] == 1 && dims_in[i][dims_in[i].size() - 1] != 1)) {
                     canCollapse = false;
@@ -371,11 +468,11 @@ void MKLDNNSnippetNode::define_schedule() {
         return collapsedDims;
     };
 
-    auto initSchedulingInfo = [this, dataSize]() -> void {
+    auto initSchedulingInfo = [this, hasRowReductions]() -> void {
         // initialize scheduling information
-        sch_offsets_in.resize(offsets_in.size(), 0);
-        sch_offsets_out.resize(offsets_out.size(), 0);
-        sch_dims.resize(maxTileRank, 1);
+        sch_offsets_in.assign(offsets_in.size(), 0);
+        sch_offsets_out.assign(offsets_out.size(), 0);
+        sch_dims.assign(maxTileRank, 1);
         sch_dims[maxTileRank-1] = exec_domain.back();
         schedulerWorkAmount = fullWorkAmount / exec_domain.back();
         if (tileRank > 1) {
@@ -386,16 +483,19 @@ void MKLDNNSnippetNode::define_schedule() {
             // update offsets for tile 2D because loaders have ptr shifts in some cases and stores have always ptrs shifts
             for (size_t i = 0; i < offsets_in.size(); i++) {
                 int64_t offset = offsets_in[i][tensorRank - 2];
-                if ((offset > dataSize) || (offset == 0 && dims_in[i].back() != 1)) {
-                    sch_offsets_in[i] = offset - exec_domain.back() * dataSize;
-                } else if (offset == dataSize) {
+                const int64_t inDataSize = dataSize[i];
+                if ((offset > inDataSize) || (offset == 0 && dims_in[i].back() != 1)) {
+                    sch_offsets_in[i] = offset - exec_domain.back() * inDataSize;
+                } else if (offset == inDataSize) {
                     sch_offsets_in[i] = offset;
                 }
             }
 
             for (size_t i = 0; i < offsets_out.size(); i++) {
                 int64_t offset = offsets_out[i][tensorRank - 2];
-                sch_offsets_out[i] = offset - exec_domain.back() * dataSize;
+                // the reduced outputs are stored once per row
+                const size_t storedPerRow = hasRowReductions ? dims_out[i].back() : exec_domain.back();
+                sch_offsets_out[i] = offset - storedPerRow * dataSize[offsets_in.size() + i];
             }
         }
     };
@@ -413,26 +513,53 @@ void MKLDNNSnippetNode::define_schedule() {
     initSchedulingInfo();
 }
 
-void MKLDNNSnippetNode::generate() {
-    jit_snippets_compile_args jcp;
-    jcp.output_dims = exec_domain;
-    std::copy(sch_dims.begin(), sch_dims.end(), jcp.scheduler_dims);
-    std::copy(sch_offsets_in.begin(), sch_offsets_in.end(), jcp.scheduler_offsets);
-    std::copy(sch_offsets_out.begin(), sch_offsets_out.end(), &jcp.scheduler_offsets[sch_offsets_in.size()]);
-    size_t harness_num_dims = jcp.output_dims.size() - 1;
+void MKLDNNSnippetNode::init_start_offsets() {
+    const size_t inputNum = getParentEdges().size();
+    start_offset_in.resize(inputNum);
+    srcMemPtrs.resize(inputNum);
+    for (size_t i = 0; i < inputNum; i++) {
+        const auto memPtr = getParentEdgeAt(i)->getMemoryPtr();
+        srcMemPtrs[i] = memPtr;
+        start_offset_in[i] =  memPtr->GetDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSize[i];
+    }
+
+    const size_t outputNum = outputShapes.size();
+    start_offset_out.resize(outputNum);
+    dstMemPtrs.resize(outputNum);
+    for (size_t i = 0; i < outputNum; i++) {
+        const auto memPtr = getChildEdgeAt(i)->getMemoryPtr();
+        dstMemPtrs[i] = memPtr;
+        start_offset_out[i] = memPtr->GetDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSize[inputNum + i];
+    }
+}
+
+void MKLDNNSnippetNode::fill_scheduling_args(int64_t* schedulerDims, int64_t* schedulerOffsets, int64_t* dataOffsets) {
+    std::copy(sch_dims.begin(), sch_dims.end(), schedulerDims);
+    std::copy(sch_offsets_in.begin(), sch_offsets_in.end(), schedulerOffsets);
+    std::copy(sch_offsets_out.begin(), sch_offsets_out.end(), &schedulerOffsets[sch_offsets_in.size()]);
+    size_t harness_num_dims = exec_domain.size() - 1;
     if (harness_num_dims > SNIPPETS_MAX_HARNESS_DIMS) {
         canUseOptimizedImpl = false;
         harness_num_dims = SNIPPETS_MAX_HARNESS_DIMS;
     }
     for (size_t i = 0; i < inputShapes.size(); i++) {
         auto b = offsets_in[i].begin();
-        std::copy(b, b + harness_num_dims, &jcp.data_offsets[i * harness_num_dims]);
+        std::copy(b, b + harness_num_dims, &dataOffsets[i * harness_num_dims]);
     }
     for (size_t i = 0; i < outputShapes.size(); i++) {
         auto b = offsets_out[i].begin();
-        std::copy(b, b + harness_num_dims, &jcp.data_offsets[(inputShapes.size() + i) * harness_num_dims]);
+        std::copy(b, b + harness_num_dims, &dataOffsets[(inputShapes.size() + i) * harness_num_dims]);
     }
-    schedule = snippet->generate(reinterpret_cast<void*>(&jcp));
+}
+
+ngraph::snippets::Schedule MKLDNNSnippetNode::generate(const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph,
+                                                      bool runtimeScheduling) {
+    jit_snippets_compile_args jcp;
+    jcp.output_dims = exec_domain;
+    jcp.runtime_scheduling = runtimeScheduling;
+    std::copy(dataSize.begin(), dataSize.end(), jcp.data_sizes);
+    fill_scheduling_args(jcp.scheduler_dims, jcp.scheduler_offsets, jcp.data_offsets);
+    return subgraph->generate(reinterpret_cast<void*>(&jcp));
 }
 
 void MKLDNNSnippetNode::schedule_6d(const jit_snippets_call_args& call_args) const {
@@ -12,15 +12,19 @@
 
 #include <node.h>
 #include "snippets/op/subgraph.hpp"
+#include "cache/lru_cache.h"
 
 #include <array>
+#include <unordered_map>
 
 namespace ov {
 namespace intel_cpu {
 
 /// MKLDNNSnippetNode represents subgraph node in MKLDNN plugin
 /// potentially, snippet can be placed as a postop to any support operation while it doesn't support postops itself
-/// precision: fp32
+/// precision: fp32 computations, fp32, bf16, i8 and u8 inputs and outputs
+/// dynamic shapes: the kernels are compiled with the runtime scheduling and reused for the shapes
+/// with the same broadcasting pattern, the scheduling info is cached by the input shapes
 class MKLDNNSnippetNode : public MKLDNNNode {
 public:
     MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
@@ -38,26 +42,70 @@ public:
 
     // if generator is set, it would execute generated code otherwise it would fallback to nGraph reference
     void execute(mkldnn::stream strm) override;
+    void executeDynamicImpl(mkldnn::stream strm) override;
+
+protected:
+    void prepareParams() override;
 
 private:
     static const size_t rank6D {6};
+    static const size_t schedulesCacheCapacity {16};
 
     typedef void (*kernel)(const void *, const void *);
 
-    void define_schedule();
+    // The generated code is owned by the generator of the canonicalized subgraph copy
+    struct SnippetKernel {
+        std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+        ngraph::snippets::Schedule schedule;
+    };
+    using SnippetKernelPtr = std::shared_ptr<const SnippetKernel>;
+
+    // The scheduling info of the dynamic node for particular input shapes
+    struct DynamicSchedule {
+        std::vector<size_t> exec_domain;
+        size_t schedulerWorkAmount;
+        jit_snippets_call_args callArgs;
+        SnippetKernelPtr snippetKernel;
+    };
+    using DynamicSchedulePtr = std::shared_ptr<const DynamicSchedule>;
+
+    struct ShapesKey {
+        std::vector<VectorDims> dims;  // blocked dims of the inputs
+
+        size_t hash() const;
+        bool operator==(const ShapesKey& rhs) const;
+    };
+
+    std::shared_ptr<ngraph::snippets::op::Subgraph> copy_snippet(const std::shared_ptr<ngraph::snippets::op::Subgraph>& original) const;
 
-    void generate();
+    void define_schedule(const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph);
+
+    void init_start_offsets();
+
+    // Copies the scheduling info to the compile or call arguments, which have the same layout
+    void fill_scheduling_args(int64_t* schedulerDims, int64_t* schedulerOffsets, int64_t* dataOffsets);
+
+    ngraph::snippets::Schedule generate(const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph, bool runtimeScheduling);
+
+    DynamicSchedulePtr create_dynamic_schedule();
 
     // Evaluates generated snippet using parallel backend
     void schedule_6d(const jit_snippets_call_args& const_args) const;
     void schedule_nt(const jit_snippets_call_args& const_args) const;
 
     // Local copy of subgraph node for canonization & code generation
+    // (the dynamic node keeps it intact and canonicalizes its copies for the particular shapes)
     std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
 
     // Holds generated snippet with information about how to schedule it
     ngraph::snippets::Schedule schedule;
 
+    // The scheduling info passed to the kernels with the runtime scheduling (dynamic node only)
+    jit_snippets_call_args callArgs;
+    // The kernels of the dynamic node by the broadcasting pattern of the canonicalized shapes
+    std::unordered_map<std::vector<bool>, SnippetKernelPtr> kernels;
+    LruCache<ShapesKey, DynamicSchedulePtr> schedulesCache {schedulesCacheCapacity};
+
     // Holds ISA version used is codeGeneration target
     dnnl::impl::cpu::x64::cpu_isa_t host_isa;
 
@@ -87,6 +135,8 @@ private:
     std::vector<int64_t> sch_dims = {};
     std::vector<int64_t> sch_offsets_in = {};
     std::vector<int64_t> sch_offsets_out = {};
+    // element sizes of the inputs followed by the outputs
+    std::vector<size_t> dataSize = {};
     bool canUseOptimizedImpl = true;
 };
 
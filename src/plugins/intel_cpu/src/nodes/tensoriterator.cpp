@@ -228,27 +228,28 @@ DynamicBuffer::DynamicBuffer(const MKLDNNMemoryPtr &from_, const std::vector<MKL
     elem_size = MKLDNNExtensionUtils::sizeOfDataType(from->GetDataType());
 }
 
-void DynamicBuffer::execute(const mkldnn::engine& eng, const int iter) {
-    if (iter == 0) {
-        init(eng);
-        return;
-    }
+void DynamicBuffer::execute(const mkldnn::engine& eng, const int iter, const int num_iterations) {
+    if (iter == 0)
+        init(eng, num_iterations);
+
+    const auto abs_stride = std::abs(map_rule.stride);
+    if (from->getStaticDims()[map_rule.axis] != abs_stride)
+        IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
+        " is expected, but actual: " << from->getStaticDims()[map_rule.axis];
 
-    auto new_buffer = create_buffer(eng);
-    move_buffer(new_buffer);
+    if (num_chunks == capacity) {
+        const auto new_capacity = capacity * 2;
+        auto new_buffer = create_buffer(eng, new_capacity);
+        move_buffer(new_buffer, new_capacity);
+    }
     move_data();
 }
 
-void DynamicBuffer::init(const mkldnn::engine& eng) {
-    chunk_offset_in_byte = 0;
-    buffer_offset_in_byte = 0;
-
+void DynamicBuffer::init(const mkldnn::engine& eng, const int num_iterations) {
     const auto axis = map_rule.axis;
-    const auto stride = map_rule.stride;
-    const auto abs_stride = std::abs(stride);
+    const auto abs_stride = std::abs(map_rule.stride);
 
-    auto src_mem = from->GetPrimitive();
-    auto src_desc = src_mem.get_desc();
+    auto src_desc = from->GetPrimitive().get_desc();
     auto dims = src_desc.dims();
 
     if (dims[axis] != abs_stride)
@@ -257,60 +258,55 @@ void DynamicBuffer::init(const mkldnn::engine& eng) {
 
     count = std::accumulate(dims.begin(), dims.begin() + map_rule.axis, 1, std::multiplies<size_t>());
     len = std::accumulate(dims.begin() + map_rule.axis + 1, dims.end(), elem_size, std::multiplies<size_t>());
-    mem_holder_buffer.reset(new memory(src_desc, eng));
-    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()), 0, 0, 1, from->GetSize());
-}
-
-std::shared_ptr<mkldnn::memory> DynamicBuffer::create_buffer(const mkldnn::engine& eng) {
-    const auto axis = map_rule.axis;
-    const auto stride = map_rule.stride;
-    const auto abs_stride = std::abs(stride);
-
-    const auto old_desc = mem_holder_buffer->get_desc();
-    auto dims = old_desc.dims();
-
-    if (from->getStaticDims()[axis] != abs_stride)
-        IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
-        " is expected, but actual: " << from->getStaticDims()[axis];
-
-    dims[axis] += abs_stride;
-    mkldnn::memory::desc new_buffer_desc(dims, old_desc.data_type(), MKLDNNExtensionUtils::GetPlainFormatByRank(dims.size()));
-
-    if (stride > 0.0f) {
-        chunk_offset_in_byte += new_buffer_desc.data.format_desc.blocking.strides[axis] * elem_size * abs_stride;
-    } else {
-        buffer_offset_in_byte = from->GetPrimitive().get_desc().data.format_desc.blocking.strides[axis] * elem_size * abs_stride;
-    }
-
+    chunk_size_in_byte = abs_stride * len;
+    num_chunks = 0;
+    // the whole output is allocated at once if the number of iterations is known
+    capacity = num_iterations > 0 ? static_cast<size_t>(num_iterations) : 1lu;
+    mem_holder_buffer = create_buffer(eng, capacity);
+}
+
+std::shared_ptr<mkldnn::memory> DynamicBuffer::create_buffer(const mkldnn::engine& eng, const size_t new_capacity) {
+    auto dims = from->GetPrimitive().get_desc().dims();
+    dims[map_rule.axis] = new_capacity * std::abs(map_rule.stride);
+    mkldnn::memory::desc new_buffer_desc(dims, from->GetPrimitive().get_desc().data_type(),
+                                         MKLDNNExtensionUtils::GetPlainFormatByRank(dims.size()));
     return std::make_shared<mkldnn::memory>(new_buffer_desc, eng);
 }
 
-void DynamicBuffer::move_buffer(std::shared_ptr<mkldnn::memory> new_buffer) {
-    const auto axis = map_rule.axis;
-    const auto src_stride = mem_holder_buffer->get_desc().dims()[axis] * len;
-    const auto dst_stride = new_buffer->get_desc().dims()[axis] * len;
+void DynamicBuffer::move_buffer(std::shared_ptr<mkldnn::memory> new_buffer, const size_t new_capacity) {
+    // the chunks are collected from the beginning of the rows for the positive stride and from the end otherwise
+    const auto src_offset = get_data_offset();
+    const auto dst_offset = map_rule.stride > 0 ? 0 : (new_capacity - num_chunks) * chunk_size_in_byte;
 
-    copy(get_ptr(*mem_holder_buffer.get()), get_ptr(*new_buffer.get()) + buffer_offset_in_byte,
-         src_stride, dst_stride, count, src_stride);
+    copy(get_ptr(*mem_holder_buffer.get()) + src_offset, get_ptr(*new_buffer.get()) + dst_offset,
+         capacity * chunk_size_in_byte, new_capacity * chunk_size_in_byte, count, num_chunks * chunk_size_in_byte);
     mem_holder_buffer = new_buffer;
+    capacity = new_capacity;
 }
 
 void DynamicBuffer::move_data() {
-    const auto axis = map_rule.axis;
-    const auto src_stride = abs(map_rule.stride) * len;
-    const auto dst_stride = mem_holder_buffer->get_desc().dims()[axis] * len;
+    const auto position = map_rule.stride > 0 ? num_chunks : capacity - num_chunks - 1;
 
-    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()) + chunk_offset_in_byte,
-         src_stride, dst_stride, count, src_stride);
+    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()) + position * chunk_size_in_byte,
+         chunk_size_in_byte, capacity * chunk_size_in_byte, count, chunk_size_in_byte);
+    num_chunks++;
+}
+
+size_t DynamicBuffer::get_data_offset() const {
+    return map_rule.stride > 0 ? 0 : (capacity - num_chunks) * chunk_size_in_byte;
 }
 
 void DynamicBuffer::transfer(const MKLDNNNode* node) {
     if (mem_holder_buffer) {
+        auto dims = mem_holder_buffer->get_desc().dims();
+        dims[map_rule.axis] = num_chunks * std::abs(map_rule.stride);
         const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(
-                MKLDNNExtensionUtils::convertToVectorDims(mem_holder_buffer->get_desc().dims()));
+                MKLDNNExtensionUtils::convertToVectorDims(dims));
         redefineToMemories(to, desc);
 
-        copy(get_ptr(*mem_holder_buffer.get()), reinterpret_cast<uint8_t*>(to.front()->GetPtr()), 0, 0, 1, to.front()->GetSize());
+        // single gather of the collected chunks to the output
+        copy(get_ptr(*mem_holder_buffer.get()) + get_data_offset(), reinterpret_cast<uint8_t*>(to.front()->GetPtr()),
+             capacity * chunk_size_in_byte, num_chunks * chunk_size_in_byte, count, num_chunks * chunk_size_in_byte);
     } else {
         VectorDims newDims = to.front()->GetShape().getDims();
         nullifyUndefinedDims(newDims);
@@ -445,7 +441,14 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
             loopBodyCurrentIterationIdx.push_back(spec_port.current_iteration_input_idx);
         }
         if (spec_port.body_condition_output_idx != -1) {
-            loopBodyConditionOutputIdx = spec_port.body_condition_output_idx;
+            // the constant true condition never stops the loop, so it is handled as the missing one
+            const auto bodyCondition = loopOp->get_function()->get_results()[spec_port.body_condition_output_idx]
+                                           ->get_input_node_shared_ptr(0);
+            const auto constCondition = ov::as_type_ptr<const ov::op::v0::Constant>(bodyCondition);
+            if (!constCondition || ov::shape_size(constCondition->get_shape()) != 1 ||
+                !constCondition->cast_vector<bool>()[0]) {
+                loopBodyConditionOutputIdx = spec_port.body_condition_output_idx;
+            }
         }
         loopTripCountIdx = 0;
         loopExecutionConditionIdx = 1;
@@ -545,6 +548,9 @@ void MKLDNNTensorIteratorNode::executeDynamicImpl(mkldnn::stream strm) {
 
     bool continue_cond = initial_cond_check->getStatus();
     int max_num_iter = trip_count_check->getStatus();
+    // the trip count is exact if the body condition can't stop the iterations, i.e. for TensorIterator and
+    // for Loop with the constant true body condition
+    const int num_iterations = loopBodyConditionOutputIdx == -1 ? max_num_iter : -1;
 
     for (auto &mapper : first_mappers)
         mapper->execute(strm);
@@ -562,7 +568,7 @@ void MKLDNNTensorIteratorNode::executeDynamicImpl(mkldnn::stream strm) {
         continue_cond = continue_cond_check->getStatus();
 
         for (auto& buffer : buffers)
-            buffer->execute(eng, i);
+            buffer->execute(eng, i, num_iterations);
 
         // on the last iteration we shouldn't reshape body inputs and init back edges
         if ((i + 1 != max_num_iter) && continue_cond)
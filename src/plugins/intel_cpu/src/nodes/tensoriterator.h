@@ -59,32 +59,39 @@ protected:
 
 /**
  * Class for storing intermediate output buffer state for dynamism when we don't know
- * final output shape but we should concatenate output after each iteration
+ * final output shape but we should concatenate output after each iteration.
+ * The buffer capacity grows geometrically, so the chunks collected before are copied
+ * O(log N) times only, and the collected chunks are gathered to the output once after the loop.
  */
 class DynamicBuffer {
 public:
     DynamicBuffer(const MKLDNNMemoryPtr &from_, const std::vector<MKLDNNMemoryPtr> &to_, const PortMap &map_rule_);
     ~DynamicBuffer() = default;
 
-    void execute(const mkldnn::engine& eng, const int iter);
+    /* num_iterations is the exact number of iterations if it is known before the first one or -1 */
+    void execute(const mkldnn::engine& eng, const int iter, const int num_iterations = -1);
     void transfer(const MKLDNNNode* node);
 
 private:
-    void init(const mkldnn::engine& eng);
+    void init(const mkldnn::engine& eng, const int num_iterations);
 
     /* methods for resize and refill buffer */
-    std::shared_ptr<mkldnn::memory> create_buffer(const mkldnn::engine& eng);
-    void move_buffer(std::shared_ptr<mkldnn::memory> new_buffer);
+    std::shared_ptr<mkldnn::memory> create_buffer(const mkldnn::engine& eng, const size_t new_capacity);
+    void move_buffer(std::shared_ptr<mkldnn::memory> new_buffer, const size_t new_capacity);
     void move_data();
 
+    /* offset of the first collected chunk in a row of the buffer */
+    size_t get_data_offset() const;
+
     static void copy(const uint8_t* src, uint8_t* dst, const size_t src_stride, const size_t dst_stride, const size_t count, const size_t len);
     static uint8_t* get_ptr(mkldnn::memory& prim);
 
     size_t len = 1lu;
     size_t count = 1lu;
     size_t elem_size = 0lu;
-    ptrdiff_t chunk_offset_in_byte = 0;
-    ptrdiff_t buffer_offset_in_byte = 0;
+    size_t chunk_size_in_byte = 0lu;  // size of the chunk of a single iteration in a row of the buffer
+    size_t capacity = 0lu;            // number of chunks a row of the buffer can hold
+    size_t num_chunks = 0lu;          // number of chunks collected
 
     MKLDNNMemoryPtr from;
     std::vector<MKLDNNMemoryPtr> to;
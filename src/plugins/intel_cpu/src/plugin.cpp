@@ -9,6 +9,7 @@
 #include "extension.h"
 #include "itt.h"
 #include "serialize.h"
+#include "streams_calibration.h"
 
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
@@ -529,7 +530,7 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
                                       });
                     // todo: clarify whether we can evaluate snippets on inputs with larger ranks
                     auto rank_is_too_large = [](const ov::descriptor::Tensor& t ) {
-                        // callback is called has_supported_in_out(), so it's safe to assume that the shapes are static
+                        // callback is called has_supported_in_out(), so it's safe to assume that the ranks are static
                         return t.get_partial_shape().rank().get_length() > 6;
                     };
                     const bool bad_input_rank = std::any_of(inputs.begin(), inputs.end(),
@@ -554,17 +555,17 @@ static bool streamsSet(const std::map<std::string, std::string>& config) {
            config.count(ov::num_streams.name());
 }
 
-void Engine::ApplyPerformanceHints(std::map<std::string, std::string> &config, const std::shared_ptr<ngraph::Function>& ngraphFunc) const {
+bool Engine::ApplyPerformanceHints(std::map<std::string, std::string> &config, const std::shared_ptr<ngraph::Function>& ngraphFunc) const {
     const bool streamsExplicitlySetForModel = streamsSet(config);
     // checking streams (to avoid overriding what user might explicitly set in the incoming config or previously via SetConfig)
     if (streamsExplicitlySetForModel ||
         streamsExplicitlySetForEngine)
-        return;
+        return false;
 
     const auto& mode = config.find(CONFIG_KEY(PERFORMANCE_HINT));
     // the mode may have just arrived to the LoadNetwork, or was set with the plugin's SetConfig
     if (mode == config.end() && engConfig.perfHintsConfig.ovPerfHint.empty())
-        return;
+        return false;
     /* performance hints set for network has higher pririty than engine ones.
      * This applies for all the configuration parameters */
     const auto mode_name = (mode != config.end()) ?
@@ -632,7 +633,25 @@ void Engine::ApplyPerformanceHints(std::map<std::string, std::string> &config, c
         }
         config[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = std::to_string(num_streams);
         config[ov::num_streams.name()] = ov::util::to_string(num_streams);
+        return true;
+    }
+    return false;
+}
+
+// the numbers of streams the calibration chooses from for the THROUGHPUT hint
+static std::vector<int> getStreamsCalibrationCandidates(const Config& conf) {
+    // the heuristics choice goes first, so it is kept if the others are not faster
+    std::vector<int> candidates{conf.streamExecutorConfig._streams};
+    const auto num_cores = getNumberOfCPUCores();
+    const auto default_num_streams = IStreamsExecutor::Config::GetDefaultNumStreams();
+    for (const auto num_streams : {num_cores, std::max(default_num_streams, num_cores / 2), default_num_streams}) {
+        auto candidate = num_streams;
+        if (conf.perfHintsConfig.ovPerfHintNumRequests > 0)
+            candidate = std::min(candidate, conf.perfHintsConfig.ovPerfHintNumRequests);
+        if (candidate > 0 && std::find(candidates.begin(), candidates.end(), candidate) == candidates.end())
+            candidates.push_back(candidate);
     }
+    return candidates;
 }
 
 InferenceEngine::IExecutableNetworkInternal::Ptr
@@ -690,7 +709,7 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         }
     }
 
-    ApplyPerformanceHints(config, nGraphFunc);
+    const bool streamsByHeuristics = ApplyPerformanceHints(config, nGraphFunc);
 
     ConvertToCPUSpecificOpset(nGraphFunc);
 
@@ -703,6 +722,16 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
+    // the calibration infers the network, so it is done for the static shapes only
+    if (streamsByHeuristics && conf.streamsCalibrationTime > 0 && !conf.exclusiveAsyncRequests &&
+        !conf.enableDynamicBatch && !nGraphFunc->is_dynamic()) {
+        const auto num_streams = CalibrateNumStreams(clonedNetwork, conf, getStreamsCalibrationCandidates(conf),
+                                                     extensionManager, weightsSharing, shared_from_this());
+        conf.readProperties({{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(num_streams)}});
+        // exported along with the network, so the imported one doesn't repeat the calibration
+        conf.calibratedNumStreams = num_streams;
+    }
+
     return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing, shared_from_this());
 }
 
@@ -1000,6 +1029,14 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
         conf.batchLimit = static_cast<int>(cnnnetwork.getBatchSize());
     }
 
+    // the number of streams calibrated for the THROUGHPUT hint is used unless the streams are set explicitly
+    const auto calibratedNumStreams = deserializer.getCalibratedNumStreams();
+    if (calibratedNumStreams > 0 && conf.streamsCalibrationTime > 0 && !streamsSet(config) &&
+        !streamsExplicitlySetForEngine && conf.perfHintsConfig.ovPerfHint == CONFIG_VALUE(THROUGHPUT)) {
+        conf.readProperties({{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(calibratedNumStreams)}});
+        conf.calibratedNumStreams = calibratedNumStreams;
+    }
+
     auto execNetwork = std::make_shared<MKLDNNExecNetwork>(cnnnetwork, conf, extensionManager, weightsSharing, shared_from_this());
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
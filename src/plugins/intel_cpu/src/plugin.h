@@ -48,7 +48,8 @@ private:
 
     InferenceEngine::Parameter GetConfigLegacy(const std::string& name, const std::map<std::string, InferenceEngine::Parameter>& options) const;
 
-    void ApplyPerformanceHints(std::map<std::string, std::string> &config, const std::shared_ptr<ngraph::Function>& ngraphFunc) const;
+    // returns true if the number of streams was chosen by the THROUGHPUT hint heuristics
+    bool ApplyPerformanceHints(std::map<std::string, std::string> &config, const std::shared_ptr<ngraph::Function>& ngraphFunc) const;
 
     Config engConfig;
     NumaNodesWeights weightsSharing;
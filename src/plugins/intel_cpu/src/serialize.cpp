@@ -5,8 +5,12 @@
 
 #include <openvino/pass/serialize.hpp>
 
+#include <ie_system_conf.h>
+#include <mkldnn.hpp>
 #include <pugixml.hpp>
 
+#include <algorithm>
+
 using namespace InferenceEngine;
 
 namespace ov {
@@ -67,9 +71,11 @@ namespace {
     }
 };  // namespace
 
-CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager)
+CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager,
+                                           int calibratedNumStreams)
     : _ostream(ostream)
-    , _extensionManager(extensionManager) {
+    , _extensionManager(extensionManager)
+    , _calibratedNumStreams(calibratedNumStreams) {
 }
 
 void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
@@ -115,6 +121,14 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
                     .set_value(to_string(out.second->getLayout()).c_str());
         }
 
+        // the number of streams measured on this host is valid for the same CPU only
+        if (_calibratedNumStreams > 0) {
+            auto streams = root.append_child("streams");
+            streams.append_attribute("isa").set_value(static_cast<int>(dnnl::get_effective_cpu_isa()));
+            streams.append_attribute("cores").set_value(getNumberOfCPUCores());
+            streams.append_attribute("calibrated").set_value(_calibratedNumStreams);
+        }
+
         xml_doc.save(stream);
     };
 
@@ -172,6 +186,12 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
 
     setPrecisionsAndLayouts(inputs.children("in"), network.getInputsInfo());
     setPrecisionsAndLayouts(outputs.children("out"), network.getOutputsInfo());
+
+    pugi::xml_node streams = root.child("streams");
+    if (streams && streams.attribute("isa").as_int(-1) == static_cast<int>(dnnl::get_effective_cpu_isa()) &&
+        streams.attribute("cores").as_int(-1) == getNumberOfCPUCores()) {
+        _calibratedNumStreams = std::max(streams.attribute("calibrated").as_int(0), 0);
+    }
 }
 
 }   // namespace intel_cpu
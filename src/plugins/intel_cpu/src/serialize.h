@@ -13,12 +13,14 @@ namespace intel_cpu {
 
 class CNNNetworkSerializer {
 public:
-    CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager);
+    CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager,
+                         int calibratedNumStreams = 0);
     void operator << (const InferenceEngine::CNNNetwork & network);
 
 private:
     std::ostream & _ostream;
     MKLDNNExtensionManager::Ptr _extensionManager;
+    int _calibratedNumStreams;
 };
 
 class CNNNetworkDeserializer {
@@ -29,13 +31,16 @@ public:
                         const InferenceEngine::Blob::CPtr&)> cnn_network_builder;
     CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn);
     void operator >> (InferenceEngine::CNNNetwork & network);
+    // the number of streams chosen by the calibration when the network was compiled, zero if it was not calibrated
+    int getCalibratedNumStreams() const {
+        return _calibratedNumStreams;
+    }
 
 private:
     std::istream & _istream;
     cnn_network_builder _cnn_network_builder;
+    int _calibratedNumStreams = 0;
 };
 
-// const std::string& model, const Blob::CPtr& weights
-
 }   // namespace intel_cpu
 }   // namespace ov
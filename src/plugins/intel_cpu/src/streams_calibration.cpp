@@ -0,0 +1,181 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "streams_calibration.h"
+#include "exec_network.h"
+#include "cache/cache_file.h"
+#include "itt.h"
+
+#include <cpp/ie_infer_request.hpp>
+#include <threading/ie_executor_manager.hpp>
+#include <ie_icore.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <ie_plugin_config.hpp>
+#include <ie_system_conf.h>
+#include <file_utils.h>
+#include "transformations/hash.hpp"
+#include <common/primitive_hashing_utils.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+namespace {
+// must be changed on any change of the file format or of the measurement method
+constexpr const char* header = "CPU_STREAMS_CALIBRATION 1";
+// the executors of the networks compiled for the measurements are not reused by the other networks
+constexpr const char* executorName = "CPUStreamsCalibrationExecutor";
+
+using Clock = std::chrono::steady_clock;
+
+std::string getCacheFilePath(const CNNNetwork& network, const Config& cfg, const std::vector<int>& candidates) {
+    // the choice is valid only for the same model, compile options, candidates and host
+    uint64_t seed = 0;
+    ov::pass::Hash(seed).run_on_model(std::const_pointer_cast<ov::Model>(network.getFunction()));
+    for (const auto& item : cfg._config) {
+        seed = dnnl::impl::hash_combine(seed, item.first + item.second);
+    }
+    for (const auto candidate : candidates) {
+        seed = dnnl::impl::hash_combine(seed, candidate);
+    }
+    seed = dnnl::impl::hash_combine(seed, static_cast<int>(dnnl::get_effective_cpu_isa()));
+    seed = dnnl::impl::hash_combine(seed, getNumberOfCPUCores());
+    seed = dnnl::impl::hash_combine(seed, getAvailableNUMANodes().size());
+    return FileUtils::makePath(cfg.cache_dir, std::to_string(seed) + ".cpu_streams");
+}
+
+bool load(const std::string& filePath, const std::vector<int>& candidates, int& numStreams) {
+    std::ifstream file(filePath);
+    if (!file.is_open())
+        return false;
+
+    std::string line;
+    if (!std::getline(file, line) || line != header)
+        return false;
+    // the file is a cache, so a corrupted record is simply ignored
+    return (file >> numStreams) && std::find(candidates.begin(), candidates.end(), numStreams) != candidates.end();
+}
+
+void save(const std::string& filePath, int numStreams) {
+    std::stringstream content;
+    content << header << '\n' << numStreams << '\n';
+    writeCacheFile(filePath, content.str());
+}
+
+// releases the idle executors left in the executor manager by the measurements
+struct ExecutorsCleaner {
+    ~ExecutorsCleaner() {
+        executorManager->clear(executorName);
+    }
+    ExecutorManager::Ptr executorManager;
+};
+
+// returns the number of inferences per second, or zero if nothing was measured before the deadline
+double measureThroughput(const IExecutableNetworkInternal::Ptr& execNetwork, int numStreams, Clock::time_point deadline) {
+    // a request per stream keeps all the streams busy
+    std::vector<IInferRequestInternal::Ptr> requests(std::max(numStreams, 1));
+    for (auto& request : requests) {
+        request = execNetwork->CreateInferRequest();
+    }
+    auto runRound = [&] {
+        for (auto& request : requests) {
+            request->StartAsync();
+        }
+        for (auto& request : requests) {
+            request->Wait(InferRequest::WaitMode::RESULT_READY);
+        }
+    };
+
+    // the first inferences allocate the memory and fill the caches, so they are not measured
+    runRound();
+    size_t numInferences = 0;
+    const auto start = Clock::now();
+    auto now = start;
+    while (now < deadline) {
+        runRound();
+        numInferences += requests.size();
+        now = Clock::now();
+    }
+    const auto seconds = std::chrono::duration<double>(now - start).count();
+    return seconds > 0 ? numInferences / seconds : 0;
+}
+}   // namespace
+
+int ov::intel_cpu::CalibrateNumStreams(const CNNNetwork& network,
+                                       const Config& cfg,
+                                       const std::vector<int>& candidates,
+                                       const MKLDNNExtensionManager::Ptr& extMgr,
+                                       NumaNodesWeights& weightsSharing,
+                                       const std::shared_ptr<IInferencePlugin>& plugin) {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "CalibrateNumStreams");
+    IE_ASSERT(!candidates.empty());
+    if (candidates.size() == 1)
+        return candidates.front();
+
+    const auto& core = plugin->GetCore();
+    const bool isNewApi = core && core->isNewAPI();
+
+    std::string filePath;
+    if (!cfg.cache_dir.empty()) {
+        filePath = getCacheFilePath(network, cfg, candidates);
+        int numStreams = 0;
+        if (load(filePath, candidates, numStreams))
+            return numStreams;
+    }
+
+    const ExecutorsCleaner executorsCleaner{plugin->executorManager()};
+
+    // the budget includes the compilation of the candidates, so it is split between them evenly
+    const auto start = Clock::now();
+    const auto budget = std::chrono::milliseconds(cfg.streamsCalibrationTime);
+    const auto deadline = start + budget;
+    const auto timeSlice = budget / candidates.size();
+
+    int bestNumStreams = candidates.front();
+    double bestThroughput = 0;
+    bool completed = true;
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        if (Clock::now() >= deadline) {
+            completed = false;
+            break;
+        }
+
+        double throughput = 0;
+        try {
+            Config candidateCfg = cfg;
+            candidateCfg.readProperties({{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(candidates[i])}});
+            // the networks compiled for the measurements must not touch the model cache
+            candidateCfg.cache_dir.clear();
+            candidateCfg.streamsExecutorName = executorName;
+            auto execNetwork = std::make_shared<MKLDNNExecNetwork>(network, candidateCfg, extMgr, weightsSharing, plugin);
+            // the inputs and outputs info is set by the plugin base class for the networks returned to the user
+            execNetwork->setNetworkInputs(network.getInputsInfo());
+            execNetwork->setNetworkOutputs(network.getOutputsInfo());
+            SetExeNetworkInfo(execNetwork, network.getFunction(), isNewApi);
+            throughput = measureThroughput(execNetwork, candidates[i], std::min(deadline, start + timeSlice * (i + 1)));
+        } catch (...) {
+            // the calibration is an optimization only, the heuristics choice is used if it fails
+            return candidates.front();
+        }
+        if (throughput == 0) {
+            completed = false;
+            break;
+        }
+        // the earlier candidates win the ties, the first one is the heuristics choice
+        if (throughput > bestThroughput) {
+            bestThroughput = throughput;
+            bestNumStreams = candidates[i];
+        }
+    }
+
+    // a partial measurement depends on the compilation time, so it is not reused
+    if (completed && !filePath.empty())
+        save(filePath, bestNumStreams);
+    return bestNumStreams;
+}
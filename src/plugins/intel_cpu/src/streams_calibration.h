@@ -0,0 +1,40 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+#include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
+
+#include "config.h"
+#include "extension_mngr.h"
+#include "weights_cache.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Chooses the number of streams for the THROUGHPUT performance hint by measuring the throughput of the network
+ * compiled with each of the candidate numbers of streams within the Config::streamsCalibrationTime budget.
+ * The choice is stored in the model cache directory (if it is set), so the same network compiled with the same config
+ * on the same host reuses it instead of repeating the measurements.
+ *
+ * @param network is the network converted to the CPU specific opset
+ * @param cfg is the config the network is compiled with
+ * @param candidates are the numbers of streams to choose from, the first one is returned if the measurements can't
+ * be done within the budget
+ * @return The number of streams giving the highest throughput
+ */
+int CalibrateNumStreams(const InferenceEngine::CNNNetwork& network,
+                        const Config& cfg,
+                        const std::vector<int>& candidates,
+                        const MKLDNNExtensionManager::Ptr& extMgr,
+                        NumaNodesWeights& weightsSharing,
+                        const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin);
+
+}   // namespace intel_cpu
+}   // namespace ov
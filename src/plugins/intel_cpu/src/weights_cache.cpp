@@ -5,13 +5,88 @@
 #include "weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <algorithm>
 #include <memory>
 
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 namespace ov {
 namespace intel_cpu {
 
+namespace {
+
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_move_pages)
+#define CPU_WEIGHTS_NUMA_PLACEMENT
+// the values are from <numaif.h>, so the plugin does not depend on libnuma
+constexpr int mpolInterleave = 3;
+constexpr unsigned mpolMfMove = 1u << 1;
+
+uintptr_t pageSize() {
+    static const auto size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    return size;
+}
+#endif
+
+void interleavePages(const MKLDNNMemory& memory, const std::vector<int>& numaNodes) {
+#ifdef CPU_WEIGHTS_NUMA_PLACEMENT
+    // only the pages fully covered by the memory are interleaved, not to move the neighbour allocations
+    const auto data = reinterpret_cast<uintptr_t>(memory.GetData());
+    const auto begin = (data + pageSize() - 1) / pageSize() * pageSize();
+    const auto end = (data + memory.GetSize()) / pageSize() * pageSize();
+    if (end <= begin)
+        return;
+
+    constexpr int bits = sizeof(unsigned long) * 8;  // NOLINT(runtime/int)
+    const auto maxNode = *std::max_element(numaNodes.begin(), numaNodes.end());
+    std::vector<unsigned long> mask(maxNode / bits + 1, 0ul);  // NOLINT(runtime/int)
+    for (auto node : numaNodes)
+        mask[node / bits] |= 1ul << (node % bits);
+    // the failures (e.g. no permission to move the pages) are ignored, as the placement is an optimization only
+    syscall(SYS_mbind, begin, end - begin, mpolInterleave, mask.data(), mask.size() * bits + 1, mpolMfMove);
+#endif
+}
+
+// accounts the bytes of the memory to the NUMA nodes its pages reside on (-1 for the pages not populated yet)
+bool accountPages(const MKLDNNMemory& memory, std::map<int, uint64_t>& bytesPerNode) {
+#ifdef CPU_WEIGHTS_NUMA_PLACEMENT
+    const auto data = reinterpret_cast<uintptr_t>(memory.GetData());
+    const auto dataEnd = data + memory.GetSize();
+    constexpr size_t batch = 1024;
+    std::vector<void*> pages;
+    std::vector<int> status(batch);
+    std::map<int, uint64_t> bytes;
+    for (auto page = data / pageSize() * pageSize(); page < dataEnd;) {
+        pages.clear();
+        for (; page < dataEnd && pages.size() < batch; page += pageSize())
+            pages.push_back(reinterpret_cast<void*>(page));
+        // with no target nodes the syscall just queries the nodes the pages reside on
+        if (syscall(SYS_move_pages, 0, pages.size(), pages.data(), nullptr, status.data(), 0) != 0)
+            return false;
+        for (size_t i = 0; i < pages.size(); i++) {
+            const auto pageBegin = std::max(reinterpret_cast<uintptr_t>(pages[i]), data);
+            const auto pageEnd = std::min(reinterpret_cast<uintptr_t>(pages[i]) + pageSize(), dataEnd);
+            bytes[status[i] >= 0 ? status[i] : -1] += pageEnd - pageBegin;
+        }
+    }
+    for (const auto& node : bytes)
+        bytesPerNode[node.first] += node.second;
+    return true;
+#else
+    return false;
+#endif
+}
+
+}  // namespace
+
 const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
 
+MKLDNNWeightsSharing::MKLDNNWeightsSharing(std::vector<int> interleaveNodes)
+    : interleaveNodes(std::move(interleaveNodes))
+{}
+
 MKLDNNWeightsSharing::MKLDNNSharedMemory::MKLDNNSharedMemory(
         std::unique_lock<std::mutex> && lock,
         const MKLDNNMemoryInfo::Ptr & memory,
@@ -46,6 +121,8 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::findOrCreate
         if (found == sharedWeights.end()
             || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
             newPtr = create();
+            if (interleaveNodes.size() > 1 && newPtr && newPtr->isAllocated())
+                interleavePages(*newPtr, interleaveNodes);
             ptr = std::make_shared<MKLDNNMemoryInfo>(newPtr, valid);
             sharedWeights[key] = ptr;
         }
@@ -71,9 +148,60 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const st
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+std::vector<MKLDNNMemoryPtr> MKLDNNWeightsSharing::getMemories() const {
+    std::vector<MKLDNNMemoryPtr> memories;
+    std::unique_lock<std::mutex> lock(guard);
+    for (const auto& weights : sharedWeights) {
+        if (auto memory = weights.second->sharedMemory.lock())
+            memories.push_back(memory);
+    }
+    return memories;
+}
+
 NumaNodesWeights::NumaNodesWeights() {
-    for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
+    const auto numaNodes = InferenceEngine::getAvailableNUMANodes();
+    for (auto numa_id : numaNodes)
         _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
+    _interleaved_cache = std::make_shared<MKLDNNWeightsSharing>(numaNodes);
+    _first_touch_cache = std::make_shared<MKLDNNWeightsSharing>();
+}
+
+MKLDNNWeightsSharing::Ptr& NumaNodesWeights::get(int numa_id, Config::WeightsNumaPolicy policy) {
+    switch (policy) {
+    case Config::WeightsNumaPolicy::Interleave:
+        return _interleaved_cache;
+    case Config::WeightsNumaPolicy::FirstTouch:
+        return _first_touch_cache;
+    default:
+        return (*this)[numa_id];
+    }
+}
+
+std::map<int, uint64_t> NumaNodesWeights::getBytesPerNode(Config::WeightsNumaPolicy policy) const {
+    std::map<int, uint64_t> bytesPerNode;
+    auto account = [&bytesPerNode](const MKLDNNWeightsSharing::Ptr& cache, int defaultNode) {
+        for (const auto& memory : cache->getMemories()) {
+            if (!memory->isAllocated())
+                continue;
+            // if the placement can't be queried, the memory is accounted to the node the cache is created for
+            if (!accountPages(*memory, bytesPerNode))
+                bytesPerNode[defaultNode] += memory->GetSize();
+        }
+    };
+
+    switch (policy) {
+    case Config::WeightsNumaPolicy::Interleave:
+        account(_interleaved_cache, -1);
+        break;
+    case Config::WeightsNumaPolicy::FirstTouch:
+        account(_first_touch_cache, -1);
+        break;
+    default:
+        for (const auto& cache : _cache_map)
+            account(cache.second, cache.first);
+        break;
+    }
+    return bytesPerNode;
 }
 
 MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "cpu_memory.h"
+#include "config.h"
 
 #include <unordered_map>
 #include <functional>
@@ -13,6 +14,7 @@
 #include <atomic>
 #include <mutex>
 #include <map>
+#include <vector>
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -70,6 +72,12 @@ class MKLDNNWeightsSharing {
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
 
+    /**
+     * @param interleaveNodes is the NUMA nodes the memory pages of the created weights are interleaved between
+     * (no interleaving, if less than two nodes are given)
+     */
+    explicit MKLDNNWeightsSharing(std::vector<int> interleaveNodes = {});
+
     class MKLDNNSharedMemory {
     public:
         typedef std::shared_ptr<MKLDNNSharedMemory> Ptr;
@@ -96,9 +104,15 @@ public:
 
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
+    /**
+     * @brief Returns the memory objects currently kept alive by the networks using the cache
+     */
+    std::vector<MKLDNNMemoryPtr> getMemories() const;
+
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MKLDNNMemoryInfo::Ptr> sharedWeights;
+    std::vector<int> interleaveNodes;
     static const SimpleDataHash simpleCRC;
 };
 
@@ -114,8 +128,24 @@ public:
     MKLDNNWeightsSharing::Ptr& operator[](int i);
     const MKLDNNWeightsSharing::Ptr& operator[](int i) const;
 
+    /**
+     * @brief Returns the cache to be used by the streams of the NUMA node, according to the placement policy
+     * @param numa_id is the NUMA node id of the stream
+     * @param policy is the weights placement policy of the network
+     */
+    MKLDNNWeightsSharing::Ptr& get(int numa_id, Config::WeightsNumaPolicy policy);
+
+    /**
+     * @brief Returns the bytes of the weights cached for the policy per NUMA node id,
+     * the memory which placement can't be determined is accounted with the -1 id
+     */
+    std::map<int, uint64_t> getBytesPerNode(Config::WeightsNumaPolicy policy) const;
+
 private:
     std::map<int, MKLDNNWeightsSharing::Ptr> _cache_map;
+    // single copy caches of the INTERLEAVE and FIRST_TOUCH policies
+    MKLDNNWeightsSharing::Ptr _interleaved_cache;
+    MKLDNNWeightsSharing::Ptr _first_touch_cache;
 };
 
 }   // namespace intel_cpu
@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <common_test_utils/file_utils.hpp>
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "openvino/frontend/manager.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "transformations/serialize.hpp"
+
+class WeightsStreamingTest : public CommonTestUtils::TestsCommon {
+protected:
+    std::string test_name = GetTestName() + "_" + GetTimestamp();
+    std::string m_out_xml_path = test_name + ".xml";
+    std::string m_out_bin_path = test_name + ".bin";
+
+    void TearDown() override {
+        CommonTestUtils::removeIRFiles(m_out_xml_path, m_out_bin_path);
+    }
+
+    // the weights file spans several reading chunks, so the constants are read by different threads
+    std::shared_ptr<ov::Model> create_model() {
+        auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 1024});
+        std::shared_ptr<ov::Node> node = data;
+        for (size_t i = 0; i < 5; i++) {
+            std::vector<float> values(1024 * 1024);
+            for (size_t j = 0; j < values.size(); j++)
+                values[j] = static_cast<float>((i * 7 + j) % 113);
+            auto weights = ov::opset8::Constant::create(ov::element::f32, ov::Shape{1024, 1024}, values);
+            node = std::make_shared<ov::opset8::MatMul>(node, weights);
+        }
+        auto result = std::make_shared<ov::opset8::Result>(node);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{data});
+    }
+
+    std::shared_ptr<ov::Model> read_model(ov::AnyVector params) {
+        auto FE = manager.load_by_model(params);
+        if (!FE)
+            return nullptr;
+        auto inputModel = FE->load(params);
+        return inputModel ? FE->convert(inputModel) : nullptr;
+    }
+
+    ov::frontend::FrontEndManager manager;
+};
+
+TEST_F(WeightsStreamingTest, ReadWithoutMmap) {
+    auto model = create_model();
+    ngraph::pass::Manager m;
+    m.register_pass<ngraph::pass::Serialize>(m_out_xml_path, m_out_bin_path);
+    m.run_passes(model);
+
+    // 'false' disables the mapping of the weights file, so it is read in chunks in the background
+    auto read = read_model({m_out_xml_path, m_out_bin_path, false});
+    ASSERT_NE(nullptr, read);
+
+    const auto fc = FunctionsComparator::with_default().enable(FunctionsComparator::CONST_VALUES);
+    auto res = fc.compare(read, model);
+    EXPECT_TRUE(res.valid) << res.message;
+}
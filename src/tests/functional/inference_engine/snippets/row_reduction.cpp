@@ -0,0 +1,112 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ngraph/function.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <ngraph/opsets/opset8.hpp>
+
+#include <snippets/snippets_isa.hpp>
+#include <snippets/pass/collapse_subgraph.hpp>
+#include <snippets/pass/insert_load_store.hpp>
+#include <snippets/pass/row_reduction_decomposition.hpp>
+#include <snippets/pass/split_row_passes.hpp>
+#include <snippets/op/subgraph.hpp>
+
+#include <transformations/init_node_info.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace testing;
+using namespace ngraph;
+
+TEST(TransformationTests, TokenizeSoftmaxWithEltwise) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    std::shared_ptr<Function> f(nullptr);
+    {
+        auto data0 = std::make_shared<opset8::Parameter>(element::f32, Shape{2, 3, 16});
+        auto data1 = std::make_shared<opset8::Parameter>(element::f32, Shape{2, 3, 16});
+        auto add = std::make_shared<opset8::Add>(data0, data1);
+        auto softmax = std::make_shared<opset8::Softmax>(add, -1);
+        auto mul = std::make_shared<opset8::Multiply>(softmax, data1);
+        f = std::make_shared<Function>(NodeVector{mul}, ParameterVector{data0, data1});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::EnumerateNodes>();
+        m.register_pass<snippets::pass::TokenizeSnippets>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    ASSERT_EQ(count_ops_of_type<snippets::op::Subgraph>(f), 1);
+    ASSERT_EQ(count_ops_of_type<opset8::Softmax>(f), 0);
+}
+
+TEST(TransformationTests, DoNotTokenizeSoftmaxWithDynamicShape) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    std::shared_ptr<Function> f(nullptr);
+    {
+        auto data0 = std::make_shared<opset8::Parameter>(element::f32, PartialShape{-1, -1, 16});
+        auto data1 = std::make_shared<opset8::Parameter>(element::f32, PartialShape{-1, -1, 16});
+        auto add = std::make_shared<opset8::Add>(data0, data1);
+        auto softmax = std::make_shared<opset8::Softmax>(add, -1);
+        f = std::make_shared<Function>(NodeVector{softmax}, ParameterVector{data0, data1});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::EnumerateNodes>();
+        m.register_pass<snippets::pass::TokenizeSnippets>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    // the row length is required to decompose the reduction, the dynamic Add is still tokenized
+    ASSERT_EQ(count_ops_of_type<snippets::op::Subgraph>(f), 1);
+    ASSERT_EQ(count_ops_of_type<opset8::Softmax>(f), 1);
+}
+
+TEST(TransformationTests, DoNotTokenizeSoftmaxOverNotLastAxis) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto data = std::make_shared<opset8::Parameter>(element::f32, Shape{2, 3, 16});
+    auto softmax = std::make_shared<opset8::Softmax>(data, 1);
+    ASSERT_FALSE(snippets::pass::IsRowReduction(softmax));
+
+    auto reduce = std::make_shared<opset8::ReduceSum>(data, opset8::Constant::create(element::i64, Shape{1}, {2}), false);
+    ASSERT_FALSE(snippets::pass::IsRowReduction(reduce));
+}
+
+TEST(TransformationTests, SoftmaxRowPasses) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    std::shared_ptr<Function> f(nullptr);
+    {
+        auto data = std::make_shared<opset8::Parameter>(element::f32, Shape{2, 3, 16});
+        auto softmax = std::make_shared<opset8::Softmax>(data, -1);
+        f = std::make_shared<Function>(NodeVector{softmax}, ParameterVector{data});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::RowReductionDecomposition>();
+        m.register_pass<snippets::pass::InsertLoad>();
+        m.register_pass<snippets::pass::InsertStore>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    ASSERT_EQ(count_ops_of_type<opset8::Softmax>(f), 0);
+    ASSERT_EQ(count_ops_of_type<snippets::op::RowMax>(f), 1);
+    ASSERT_EQ(count_ops_of_type<snippets::op::RowSum>(f), 1);
+
+    snippets::pass::SplitRowPasses().run_on_model(f);
+
+    // RowMax is accumulated in the first row pass, RowSum in the second one and the result is stored in the third one
+    for (const auto& op : f->get_ordered_ops()) {
+        if (ov::is_type<snippets::op::RowMax>(op)) {
+            ASSERT_EQ(snippets::pass::GetRowStage(op), 1);
+        } else if (ov::is_type<snippets::op::RowSum>(op)) {
+            ASSERT_EQ(snippets::pass::GetRowStage(op), 3);
+        } else if (ov::is_type<snippets::op::Store>(op)) {
+            ASSERT_EQ(snippets::pass::GetRowStage(op), 5);
+        }
+    }
+}
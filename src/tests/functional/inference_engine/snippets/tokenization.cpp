@@ -95,6 +95,58 @@ TEST(TransformationTests, StartSubgraphMultipleOutputs) {
     ASSERT_TRUE(res.first) << res.second;
 }
 
+TEST(TransformationTests, TokenizeConvertsFromAndToLowPrecision) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    std::shared_ptr<Model> f(nullptr);
+    {
+        auto data0 = std::make_shared<op::v0::Parameter>(element::u8, Shape{2, 3});
+        auto data1 = std::make_shared<op::v0::Parameter>(element::i8, Shape{1, 3});
+        auto convert0 = std::make_shared<op::v0::Convert>(data0, element::f32);
+        auto convert1 = std::make_shared<op::v0::Convert>(data1, element::f32);
+        const std::vector<float> const_values{3, 2, 10};
+        auto const_data = std::make_shared<op::v0::Constant>(element::f32, Shape{1, 3}, const_values);
+        auto add = std::make_shared<op::v1::Add>(convert0, convert1);
+        auto sub = std::make_shared<op::v1::Subtract>(add, const_data);
+        auto mul = std::make_shared<op::v1::Multiply>(add, sub);
+        auto convert2 = std::make_shared<op::v0::Convert>(mul, element::bf16);
+        f = std::make_shared<Model>(NodeVector{convert2}, ParameterVector{data0, data1});
+        pass::Manager m;
+        m.register_pass<InitNodeInfo>();
+        m.register_pass<EnumerateNodes>();
+        m.register_pass<TokenizeSnippets>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    // the conversions to and from f32 are performed inside the subgraph
+    ASSERT_EQ(count_ops_of_type<Subgraph>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(f), 0);
+    ASSERT_EQ(f->get_output_element_type(0), element::bf16);
+}
+
+TEST(TransformationTests, TokenizeDynamicShapes) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    std::shared_ptr<Model> f(nullptr);
+    {
+        auto data0 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1, 3});
+        auto data1 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, 1, 3});
+        const std::vector<float> const_values{3, 2, 10};
+        auto const_data = std::make_shared<op::v0::Constant>(element::f32, Shape{1, 1, 3}, const_values);
+        auto add = std::make_shared<op::v1::Add>(data0, data1);
+        auto sub = std::make_shared<op::v1::Subtract>(add, const_data);
+        auto mul = std::make_shared<op::v1::Multiply>(add, sub);
+        f = std::make_shared<Model>(NodeVector{mul}, ParameterVector{data0, data1});
+        pass::Manager m;
+        m.register_pass<InitNodeInfo>();
+        m.register_pass<EnumerateNodes>();
+        m.register_pass<TokenizeSnippets>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    // the shapes are scheduled at runtime, so only the static ranks are required
+    ASSERT_EQ(count_ops_of_type<Subgraph>(f), 1);
+    ASSERT_EQ(f->get_output_partial_shape(0), PartialShape({-1, -1, 3}));
+}
+
 TEST(TransformationTests, TokenizeMulAddSubgraph) {
     SKIP_IF_CURRENT_TEST_IS_DISABLED()
     std::shared_ptr<Model> f(nullptr), f_ref(nullptr);
@@ -2,7 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <chrono>
+#include <condition_variable>
 #include <future>
+#include <mutex>
 
 #include <gtest/gtest.h>
 
@@ -140,6 +143,57 @@ TEST_P(TaskExecutorTests, executorNotReleasedUntilTasksAreDone) {
     ASSERT_EQ(MAX_NUMBER_OF_TASKS_IN_QUEUE, sharedVar);
 }
 
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+TEST(CPUStreamsExecutorWorkStealingTests, busyStreamUsesThreadsOfIdleStream) {
+    if (getAvailableNUMANodes().size() > 1)
+        GTEST_SKIP() << "the streams are placed on different NUMA nodes";
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 2, 2, IStreamsExecutor::ThreadBindingType::NONE};
+    config._workStealing = true;
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(config);
+
+    // the only busy stream runs in the arena shared with the idle stream (the stream is counted as busy until
+    // a moment after its task is done, so the task is retried)
+    auto runAlone = [&] {
+        int maxThreads = 0;
+        for (int i = 0; i < 100 && 4 != maxThreads; ++i) {
+            if (i > 0)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            async(taskExecutor, [&] { maxThreads = parallel_get_max_threads(); }).get();
+        }
+        return maxThreads;
+    };
+    ASSERT_EQ(4, runAlone());
+
+    // while the other stream is busy, the stream runs in its own arena
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool isStarted = false;
+    bool isBlocked = true;
+    auto busy = async(taskExecutor, [&] {
+        std::unique_lock<std::mutex> lock(mutex);
+        isStarted = true;
+        cv.notify_all();
+        cv.wait(lock, [&] { return !isBlocked; });
+    });
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] { return isStarted; });
+    }
+    int maxThreads = 0;
+    async(taskExecutor, [&] { maxThreads = parallel_get_max_threads(); }).get();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        isBlocked = false;
+    }
+    cv.notify_all();
+    busy.get();
+    EXPECT_EQ(2, maxThreads);
+
+    // once the other stream is idle again, its threads are lent to the busy one
+    EXPECT_EQ(4, runAlone());
+}
+#endif
+
 class ASyncTaskExecutorTests : public TaskExecutorTests {};
 
 // TODO: Issue-11695
@@ -208,6 +262,11 @@ static auto Executors = ::testing::Values(
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
     },
+    [] {
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 2, 1, IStreamsExecutor::ThreadBindingType::NONE};
+        config._workStealing = true;
+        return std::make_shared<CPUStreamsExecutor>(config);
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
     }
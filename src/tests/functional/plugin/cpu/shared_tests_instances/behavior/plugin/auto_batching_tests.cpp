@@ -18,6 +18,14 @@ INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_CPU, AutoBatching_Test,
                 ::testing::ValuesIn(num_requests),
                 ::testing::ValuesIn(num_batch)),
                          AutoBatching_Test::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_CPU, AutoBatching_Test_PartialBatch,
+        ::testing::Values(
+                std::make_tuple(CommonTestUtils::DEVICE_CPU, 4, 1),
+                std::make_tuple(CommonTestUtils::DEVICE_CPU, 4, 2),
+                std::make_tuple(CommonTestUtils::DEVICE_CPU, 4, 3),
+                std::make_tuple(CommonTestUtils::DEVICE_CPU, 8, 5)),
+                         AutoBatching_Test_PartialBatch::getTestCaseName);
 // TODO: for 22.2 (CVS-68949)
 //INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_CPU, AutoBatching_Test_DetectionOutput,
 //                         ::testing::Combine(
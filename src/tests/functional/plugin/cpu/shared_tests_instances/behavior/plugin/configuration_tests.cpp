@@ -51,6 +51,10 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::NO}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
             {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{"CPU_WEIGHTS_NUMA_POLICY", "REPLICATE"}},
+            {{"CPU_WEIGHTS_NUMA_POLICY", "INTERLEAVE"}},
+            {{"CPU_WEIGHTS_NUMA_POLICY", "FIRST_TOUCH"}},
+            {{"CPU_STREAMS_CALIBRATION_TIME", "0"}},
             // check that hints doesn't override customer value (now for streams and later for other config opts)
             {{InferenceEngine::PluginConfigParams::KEY_PERFORMANCE_HINT, InferenceEngine::PluginConfigParams::THROUGHPUT},
              {InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "3"}},
@@ -131,7 +135,9 @@ namespace {
                     {InferenceEngine::PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS, "should be int"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "OFF"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{"CPU_WEIGHTS_NUMA_POLICY", "SPREAD"}},
+            {{"CPU_STREAMS_CALIBRATION_TIME", "NAN"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
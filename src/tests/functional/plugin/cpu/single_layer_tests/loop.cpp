@@ -406,6 +406,18 @@ INSTANTIATE_TEST_SUITE_P(smoke_LoopForCommon, LoopLayerCPUTest,
                                  ::testing::ValuesIn(inputPrecisions)),
                          LoopLayerCPUTest::getTestCaseName);
 
+// the body condition is the constant true, so the outputs of the long loops are concatenated into the buffer
+// allocated once for the whole trip count
+INSTANTIATE_TEST_SUITE_P(smoke_LoopForLongTripCount, LoopLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::Values(trip_count_type[0]),
+                                 ::testing::Values(1000),
+                                 ::testing::Values(true),
+                                 ::testing::ValuesIn(inputs),
+                                 ::testing::Values(types),
+                                 ::testing::Values(ElementType::f32)),
+                         LoopLayerCPUTest::getTestCaseName);
+
 std::vector<std::vector<InputShape>> inputs_2 = {
     {  //first test suit
         {   //dynamic shape
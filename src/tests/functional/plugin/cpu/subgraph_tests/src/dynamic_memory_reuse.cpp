@@ -0,0 +1,39 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+// The intermediate memory of the dynamic graph is reused between the inferences with the repeated shapes,
+// so the shapes go back and forth to check the memory is rebound correctly
+class DynamicMemoryReuse : public SubgraphBaseTest {
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape inputShapes{{-1, -1}, {{2, 16}, {8, 16}, {2, 16}, {4, 32}, {8, 16}, {2, 16}, {4, 32}}};
+
+        init_input_shapes({inputShapes});
+        auto inputParams = ngraph::builder::makeDynamicParams(ngraph::element::f32, inputDynamicShapes);
+        auto softmax1 = std::make_shared<ngraph::opset1::Softmax>(inputParams.front(), 1);
+        auto matMul = std::make_shared<ngraph::opset1::MatMul>(softmax1, softmax1, false, true);
+        auto softmax2 = std::make_shared<ngraph::opset1::Softmax>(matMul, 1);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(softmax2)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "dynamicMemoryReuse");
+    }
+};
+
+TEST_F(DynamicMemoryReuse, smoke_DynamicMemoryReuse) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,69 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include <cstring>
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+// Checks that the dynamic input is bound to (and then released from) the user memory correctly,
+// depending on whether the user tensor is aligned or not
+class InputZeroCopyDynamic : public ::testing::Test {
+protected:
+    std::shared_ptr<ov::Model> create_test_function() {
+        auto param = std::make_shared<opset8::Parameter>(element::f32, ov::PartialShape{ov::Dimension::dynamic(), 3});
+        param->get_output_tensor(0).set_names({"tensor_input_0"});
+        auto relu = std::make_shared<opset8::Relu>(param);
+        auto result = std::make_shared<opset8::Result>(relu);
+        result->get_output_tensor(0).set_names({"tensor_output_0"});
+        return std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{param});
+    }
+
+    static void fill(float* data, size_t size, size_t seed) {
+        for (size_t i = 0; i < size; i++)
+            data[i] = (i % 2 ? -1.f : 1.f) * static_cast<float>(i + seed);
+    }
+
+    static void check(const ov::Tensor& output, const float* input) {
+        const auto* actual = output.data<const float>();
+        for (size_t i = 0; i < output.get_size(); i++)
+            ASSERT_EQ(actual[i], std::max(input[i], 0.f)) << "at " << i;
+    }
+};
+
+TEST_F(InputZeroCopyDynamic, AlignedAndMisalignedTensors) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    std::shared_ptr<ov::Core> ie = ov::test::utils::PluginCache::get().core();
+    auto compiled_model = ie->compile_model(create_test_function(), "CPU");
+    ov::InferRequest req = compiled_model.create_infer_request();
+
+    const std::vector<ov::Shape> shapes = {{4, 3}, {2, 3}, {8, 3}, {2, 3}};
+    std::vector<uint8_t> misaligned_storage(ov::shape_size(shapes[2]) * sizeof(float) + 1);
+    for (size_t i = 0; i < shapes.size(); i++) {
+        // every second tensor is misaligned on purpose, so it has to be copied
+        ov::Tensor input = i % 2 ? ov::Tensor(element::f32, shapes[i], misaligned_storage.data() + 1)
+                                 : ov::Tensor(element::f32, shapes[i]);
+        std::vector<float> reference(input.get_size());
+        fill(reference.data(), reference.size(), i);
+        std::memcpy(input.data(), reference.data(), reference.size() * sizeof(float));
+
+        req.set_tensor("tensor_input_0", input);
+        req.infer();
+        check(req.get_tensor("tensor_output_0"), reference.data());
+    }
+
+    auto stats = compiled_model.get_property("CPU_ZERO_COPY_STATISTICS")
+                     .as<std::map<std::string, uint64_t>>();
+    EXPECT_EQ(stats["INPUTS_ZERO_COPY"] + stats["INPUTS_COPIED"], shapes.size());
+    EXPECT_GE(stats["INPUTS_COPIED"], shapes.size() / 2);
+    EXPECT_EQ(stats["OUTPUTS_ZERO_COPY"] + stats["OUTPUTS_COPIED"], shapes.size());
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,165 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/op/util/variable.hpp>
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+// Checks that the state is passed between the inferences when the new state is written
+// to the other buffer than the one the current state is read from
+class MemoryStateDoubleBuffer : public ::testing::Test {
+protected:
+    static constexpr size_t size = 8;
+
+    // Result(Add(Param, ReadValue)), Assign(Param)
+    // The Assign doesn't depend on the ReadValue, so it may be executed first
+    std::shared_ptr<ov::Model> create_test_function() {
+        auto param = std::make_shared<opset8::Parameter>(element::f32, Shape{1, size});
+        auto variable = std::make_shared<Variable>(VariableInfo{PartialShape{1, size}, element::f32, "state"});
+        auto init = opset8::Constant::create(element::f32, Shape{1, size}, {0});
+        auto read = std::make_shared<opset8::ReadValue>(init, variable);
+        auto add = std::make_shared<opset8::Add>(param, read);
+        auto assign = std::make_shared<opset8::Assign>(param, variable);
+        auto result = std::make_shared<opset8::Result>(add);
+        return std::make_shared<ov::Model>(ResultVector{result}, SinkVector{assign}, ParameterVector{param});
+    }
+
+    static std::vector<float> infer(ov::InferRequest& request, float value) {
+        auto input = request.get_input_tensor();
+        std::fill_n(input.data<float>(), size, value);
+        request.infer();
+        auto output = request.get_output_tensor();
+        return {output.data<float>(), output.data<float>() + size};
+    }
+
+    static std::vector<float> get_state(ov::InferRequest& request) {
+        auto states = request.query_state();
+        EXPECT_EQ(states.size(), 1);
+        auto state = states.front().get_state();
+        return {state.data<float>(), state.data<float>() + size};
+    }
+};
+
+TEST_F(MemoryStateDoubleBuffer, StateIsPassedBetweenInferences) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    std::shared_ptr<ov::Core> core = ov::test::utils::PluginCache::get().core();
+    auto compiled_model = core->compile_model(create_test_function(), "CPU");
+    auto request = compiled_model.create_infer_request();
+    auto other_request = compiled_model.create_infer_request();
+
+    EXPECT_EQ(infer(request, 1.f), std::vector<float>(size, 1.f));
+    EXPECT_EQ(infer(request, 2.f), std::vector<float>(size, 3.f));
+    EXPECT_EQ(infer(request, 3.f), std::vector<float>(size, 5.f));
+    EXPECT_EQ(get_state(request), std::vector<float>(size, 3.f));
+
+    // the requests sharing the graph have their own states
+    EXPECT_EQ(infer(other_request, 10.f), std::vector<float>(size, 10.f));
+    EXPECT_EQ(get_state(request), std::vector<float>(size, 3.f));
+    EXPECT_EQ(infer(request, 4.f), std::vector<float>(size, 7.f));
+
+    auto state = request.query_state().front();
+    ov::Tensor new_state(element::f32, Shape{1, size});
+    std::fill_n(new_state.data<float>(), size, 100.f);
+    state.set_state(new_state);
+    EXPECT_EQ(infer(request, 1.f), std::vector<float>(size, 101.f));
+
+    state.reset();
+    EXPECT_EQ(infer(request, 5.f), std::vector<float>(size, 5.f));
+    EXPECT_EQ(get_state(request), std::vector<float>(size, 5.f));
+
+    // the returned state is not overwritten by the next inferences
+    auto saved_state = state.get_state();
+    infer(request, 6.f);
+    infer(request, 7.f);
+    EXPECT_EQ(std::vector<float>(saved_state.data<float>(), saved_state.data<float>() + size),
+              std::vector<float>(size, 5.f));
+}
+
+TEST_F(MemoryStateDoubleBuffer, NewRequestDoesNotInheritStateOfDestroyedRequest) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    std::shared_ptr<ov::Core> core = ov::test::utils::PluginCache::get().core();
+    auto compiled_model = core->compile_model(create_test_function(), "CPU");
+    {
+        auto request = compiled_model.create_infer_request();
+        EXPECT_EQ(infer(request, 1.f), std::vector<float>(size, 1.f));
+        EXPECT_EQ(infer(request, 2.f), std::vector<float>(size, 3.f));
+    }
+
+    // the graph is shared, but it must not refer to the buffers of the destroyed request
+    auto request = compiled_model.create_infer_request();
+    EXPECT_EQ(get_state(request), std::vector<float>(size, 0.f));
+    EXPECT_EQ(infer(request, 5.f), std::vector<float>(size, 5.f));
+    EXPECT_EQ(get_state(request), std::vector<float>(size, 5.f));
+}
+
+TEST_F(MemoryStateDoubleBuffer, SessionsAreSwitchedByAttachingState) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    std::shared_ptr<ov::Core> core = ov::test::utils::PluginCache::get().core();
+    auto compiled_model = core->compile_model(create_test_function(), "CPU");
+    auto request = compiled_model.create_infer_request();
+
+    std::vector<ov::Tensor> sessions(2);
+    for (auto& session : sessions) {
+        session = ov::Tensor(element::f32, Shape{1, size});
+        std::fill_n(session.data<float>(), size, 0.f);
+    }
+
+    auto state = request.query_state().front();
+    auto step = [&](size_t session, float value) {
+        state.attach_state(sessions[session]);
+        auto result = infer(request, value);
+        sessions[session] = state.detach_state();
+        return result;
+    };
+
+    EXPECT_EQ(step(0, 1.f), std::vector<float>(size, 1.f));
+    EXPECT_EQ(step(1, 10.f), std::vector<float>(size, 10.f));
+    EXPECT_EQ(step(0, 2.f), std::vector<float>(size, 3.f));
+    EXPECT_EQ(step(1, 20.f), std::vector<float>(size, 30.f));
+    EXPECT_EQ(std::vector<float>(sessions[0].data<float>(), sessions[0].data<float>() + size),
+              std::vector<float>(size, 2.f));
+
+    // the request can't be inferred without the state
+    EXPECT_THROW(request.infer(), ov::Exception);
+    EXPECT_THROW(state.attach_state(ov::Tensor(element::f32, Shape{1, size + 1})), ov::Exception);
+}
+
+TEST_F(MemoryStateDoubleBuffer, NewRequestDoesNotReferToDetachedState) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    std::shared_ptr<ov::Core> core = ov::test::utils::PluginCache::get().core();
+    auto compiled_model = core->compile_model(create_test_function(), "CPU");
+    auto request = compiled_model.create_infer_request();
+    EXPECT_EQ(infer(request, 1.f), std::vector<float>(size, 1.f));
+
+    auto state = request.query_state().front();
+    auto detached = state.detach_state();
+    EXPECT_EQ(std::vector<float>(detached.data<float>(), detached.data<float>() + size),
+              std::vector<float>(size, 1.f));
+
+    auto new_request = compiled_model.create_infer_request();
+    EXPECT_EQ(get_state(new_request), std::vector<float>(size, 0.f));
+
+    // the detached memory is owned by the user only
+    detached = {};
+    auto other_request = compiled_model.create_infer_request();
+    EXPECT_EQ(get_state(other_request), std::vector<float>(size, 0.f));
+    EXPECT_EQ(infer(other_request, 2.f), std::vector<float>(size, 2.f));
+    EXPECT_EQ(infer(new_request, 3.f), std::vector<float>(size, 3.f));
+
+    ov::Tensor session(element::f32, Shape{1, size});
+    std::fill_n(session.data<float>(), size, 10.f);
+    state.attach_state(session);
+    EXPECT_EQ(infer(request, 4.f), std::vector<float>(size, 14.f));
+}
+
+} // namespace SubgraphTestsDefinitions
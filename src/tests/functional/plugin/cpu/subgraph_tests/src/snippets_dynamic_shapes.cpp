@@ -0,0 +1,46 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+using namespace ov::test;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+// MatMul -> eltwise chain with dynamic batch and sequence length: the eltwise ops are fused into a single snippet,
+// its kernels are reused for the shapes with the same broadcasting pattern, so the shapes are repeated
+// and some of them have the broadcasted dimensions
+class SnippetsDynamicShapes : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape inputShape{{-1, -1, 16}, {{2, 3, 16}, {1, 5, 16}, {2, 3, 16}, {1, 1, 16}, {4, 7, 16}, {1, 1, 16}}};
+        init_input_shapes({inputShape});
+
+        auto type = element::f32;
+        auto params = builder::makeDynamicParams(type, inputDynamicShapes);
+        auto weights = builder::makeConstant(type, Shape{16, 16}, std::vector<float>{}, true);
+        auto matMul = std::make_shared<opset8::MatMul>(params.front(), weights);
+        auto mul = std::make_shared<opset8::Multiply>(matMul, builder::makeConstant(type, Shape{16}, std::vector<float>{}, true));
+        auto sigmoid = std::make_shared<opset8::Sigmoid>(mul);
+        auto add = std::make_shared<opset8::Add>(sigmoid, builder::makeConstant(type, Shape{16}, std::vector<float>{}, true));
+
+        function = std::make_shared<Function>(add, params, "SnippetsDynamicShapes");
+    }
+};
+
+TEST_F(SnippetsDynamicShapes, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", 1);
+}
+
+} // namespace SubgraphTestsDefinitions
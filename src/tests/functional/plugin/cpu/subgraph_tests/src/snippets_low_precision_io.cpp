@@ -0,0 +1,57 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ngraph/opsets/opset8.hpp>
+#include <ie_system_conf.h>
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+// MaxPool(prc) -> Convert(f32) -> eltwise -> Convert(prc): the conversions are performed by the snippet loads and stores.
+// MaxPool keeps the eltwise chain away from the network input, since such chains are not tokenized by the plugin.
+class SnippetsLowPrecisionIO : public testing::WithParamInterface<element::Type>,
+                               virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<element::Type>& obj) {
+        return "prc=" + obj.param.get_type_name();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        const auto type = GetParam();
+        if (type == element::bf16) {
+            if (!InferenceEngine::with_cpu_x86_avx512_core())
+                GTEST_SKIP() << "bf16 outputs of snippets require avx512_core";
+            configuration.insert({InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16, InferenceEngine::PluginConfigParams::NO});
+        }
+
+        auto param = std::make_shared<opset8::Parameter>(type, Shape{1, 16, 10, 10});
+        auto pool = std::make_shared<opset8::MaxPool>(param, Strides{2, 2}, Strides{1, 1}, Shape{0, 0}, Shape{0, 0}, Shape{2, 2});
+        auto convertIn = std::make_shared<opset8::Convert>(pool->output(0), element::f32);
+        // the inputs are small non-negative integers, so the results are exact in all the precisions
+        auto mul = std::make_shared<opset8::Multiply>(convertIn, opset8::Constant::create(element::f32, Shape{1}, {0.5f}));
+        auto add = std::make_shared<opset8::Add>(mul, opset8::Constant::create(element::f32, Shape{1}, {2.f}));
+        auto convertOut = std::make_shared<opset8::Convert>(add, type);
+
+        function = std::make_shared<Function>(convertOut, ParameterVector{param});
+    }
+};
+
+TEST_P(SnippetsLowPrecisionIO, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    Run();
+    CheckNumberOfNodesWithType(executableNetwork, "Subgraph", 1);
+    CheckNumberOfNodesWithType(executableNetwork, "Convert", 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_SnippetsLowPrecisionIO, SnippetsLowPrecisionIO,
+                         ::testing::Values(element::bf16, element::i8, element::u8),
+                         SnippetsLowPrecisionIO::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
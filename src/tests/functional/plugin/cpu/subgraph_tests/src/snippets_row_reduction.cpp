@@ -0,0 +1,65 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ngraph/opsets/opset8.hpp>
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+// MVN or Softmax, row length
+using SnippetsRowReductionParams = std::tuple<bool, size_t>;
+
+// MatMul -> Softmax/MVN -> eltwise: the last axis normalization is fused with the eltwise ops into a single snippet
+class SnippetsRowReduction : public testing::WithParamInterface<SnippetsRowReductionParams>,
+                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SnippetsRowReductionParams>& obj) {
+        bool isMVN;
+        size_t rowLength;
+        std::tie(isMVN, rowLength) = obj.param;
+        return std::string(isMVN ? "MVN" : "Softmax") + "_row=" + std::to_string(rowLength);
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        bool isMVN;
+        size_t rowLength;
+        std::tie(isMVN, rowLength) = GetParam();
+
+        auto type = element::f32;
+        auto param = std::make_shared<opset8::Parameter>(type, Shape{2, 12, rowLength});
+        auto weights = builder::makeConstant(type, Shape{rowLength, rowLength}, std::vector<float>{}, true);
+        auto matMul = std::make_shared<opset8::MatMul>(param, weights);
+        std::shared_ptr<Node> norm;
+        if (isMVN) {
+            norm = std::make_shared<opset8::MVN>(matMul, opset8::Constant::create(element::i32, Shape{1}, {-1}),
+                                                 true, 1e-5f, op::MVNEpsMode::INSIDE_SQRT);
+        } else {
+            norm = std::make_shared<opset8::Softmax>(matMul, -1);
+        }
+        auto mul = std::make_shared<opset8::Multiply>(norm, builder::makeConstant(type, Shape{rowLength}, std::vector<float>{}, true));
+        auto add = std::make_shared<opset8::Add>(mul, builder::makeConstant(type, Shape{rowLength}, std::vector<float>{}, true));
+
+        function = std::make_shared<Function>(add, ParameterVector{param});
+    }
+};
+
+TEST_P(SnippetsRowReduction, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    Run();
+    CheckNumberOfNodesWithType(executableNetwork, "Subgraph", 1);
+}
+
+// the rows of 20 and 40 elements have the scalar tails on AVX2 and AVX512 respectively
+INSTANTIATE_TEST_SUITE_P(smoke_SnippetsRowReduction, SnippetsRowReduction,
+                         ::testing::Combine(::testing::Values(false, true),
+                                            ::testing::Values(16, 20, 40)),
+                         SnippetsRowReduction::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
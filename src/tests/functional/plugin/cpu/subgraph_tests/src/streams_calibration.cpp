@@ -0,0 +1,73 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <threading/ie_executor_manager.hpp>
+#include <openvino/runtime/core.hpp>
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+// Checks that the number of streams calibrated for the THROUGHPUT hint is reused by the network imported from the cache
+class StreamsCalibration : public ::testing::Test {
+protected:
+    void SetUp() override {
+        CommonTestUtils::createDirectory(cacheDir);
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+        CommonTestUtils::removeFilesWithExt(cacheDir, "cpu_streams");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+
+    std::shared_ptr<ov::Model> create_test_function() {
+        auto param = std::make_shared<opset8::Parameter>(element::f32, ov::Shape{1, 16, 20, 20});
+        auto conv = builder::makeConvolution(param, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 16);
+        auto relu = std::make_shared<opset8::Relu>(conv);
+        auto result = std::make_shared<opset8::Result>(relu);
+        return std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{param});
+    }
+
+    const std::string cacheDir = "StreamsCalibration_cache";
+};
+
+TEST_F(StreamsCalibration, CalibratedStreamsAreCached) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    core.set_property(ov::cache_dir(cacheDir));
+    const ov::AnyMap config = {
+        ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT),
+        {InferenceEngine::PluginConfigInternalParams::KEY_CPU_STREAMS_CALIBRATION_TIME, "1000"}};
+
+    auto compiled_model = core.compile_model(create_test_function(), "CPU", config);
+    const auto num_streams = compiled_model.get_property(ov::num_streams);
+    EXPECT_GT(num_streams, 0);
+
+    auto imported_model = core.compile_model(create_test_function(), "CPU", config);
+    EXPECT_EQ(imported_model.get_property(ov::num_streams), num_streams);
+}
+
+TEST_F(StreamsCalibration, MeasurementExecutorsAreReleased) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    const ov::AnyMap config = {
+        ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT),
+        {InferenceEngine::PluginConfigInternalParams::KEY_CPU_STREAMS_CALIBRATION_TIME, "1000"}};
+
+    const auto executorManager = InferenceEngine::executorManager();
+    const auto executorsNumber = executorManager->getIdleCPUStreamsExecutorsNumber();
+    auto compiled_model = core.compile_model(create_test_function(), "CPU", config);
+    // only the task and the callback executors of the compiled model may be added
+    EXPECT_LE(executorManager->getIdleCPUStreamsExecutorsNumber(), executorsNumber + 2);
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,77 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+// Checks that the networks compiled with the CPU_WEIGHTS_NUMA_POLICY compute the same results as with the default
+// policy and that their (reordered) convolution weights are reported by the CPU_WEIGHTS_NUMA_STATISTICS
+class WeightsNumaPolicy : public testing::WithParamInterface<std::string>, public ::testing::Test {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<std::string>& obj) {
+        return "policy=" + obj.param;
+    }
+
+protected:
+    std::shared_ptr<ov::Model> create_test_function() {
+        auto param = std::make_shared<opset8::Parameter>(element::f32, Shape{1, 16, 8, 8});
+        auto conv = builder::makeConvolution(param, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 32);
+        auto result = std::make_shared<opset8::Result>(conv);
+        return std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{param});
+    }
+
+    // infers all the requests in parallel, so every stream creates its graph (and takes the weights from the cache)
+    static std::vector<std::vector<float>> infer(ov::CompiledModel& compiled_model, size_t num_requests) {
+        std::vector<ov::InferRequest> requests;
+        for (size_t i = 0; i < num_requests; i++) {
+            requests.push_back(compiled_model.create_infer_request());
+            auto input = requests.back().get_input_tensor();
+            auto data = input.data<float>();
+            for (size_t j = 0; j < input.get_size(); j++)
+                data[j] = static_cast<float>((i + j) % 7) - 3.f;
+        }
+        for (auto& request : requests)
+            request.start_async();
+        std::vector<std::vector<float>> outputs;
+        for (auto& request : requests) {
+            request.wait();
+            auto output = request.get_output_tensor();
+            outputs.emplace_back(output.data<float>(), output.data<float>() + output.get_size());
+        }
+        return outputs;
+    }
+};
+
+TEST_P(WeightsNumaPolicy, CompareWithDefaultPolicy) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    std::shared_ptr<ov::Core> core = ov::test::utils::PluginCache::get().core();
+    const auto model = create_test_function();
+    const size_t num_streams = 2;
+    auto reference_model = core->compile_model(model, "CPU", {{"CPU_THROUGHPUT_STREAMS", std::to_string(num_streams)}});
+    auto compiled_model = core->compile_model(model, "CPU", {{"CPU_THROUGHPUT_STREAMS", std::to_string(num_streams)},
+                                                             {"CPU_WEIGHTS_NUMA_POLICY", GetParam()}});
+
+    EXPECT_EQ(infer(compiled_model, num_streams), infer(reference_model, num_streams));
+
+    auto stats = compiled_model.get_property("CPU_WEIGHTS_NUMA_STATISTICS").as<std::map<std::string, uint64_t>>();
+    uint64_t total = 0;
+    for (const auto& node : stats)
+        total += node.second;
+    // at least one copy of the 32x16x3x3 weights is cached, reordered and maybe padded
+    EXPECT_GE(total, 32 * 16 * 3 * 3 * sizeof(float));
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_WeightsNumaPolicy, WeightsNumaPolicy,
+                         ::testing::Values("REPLICATE", "INTERLEAVE", "FIRST_TOUCH"),
+                         WeightsNumaPolicy::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
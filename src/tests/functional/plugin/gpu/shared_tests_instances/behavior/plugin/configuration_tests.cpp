@@ -109,6 +109,8 @@ namespace {
     const std::vector<std::map<std::string, std::string>> auto_batch_inconfigs = {
             {{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG), CommonTestUtils::DEVICE_GPU},
                     {CONFIG_KEY(AUTO_BATCH_TIMEOUT), "-1"}},
+            {{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG), CommonTestUtils::DEVICE_GPU},
+                    {CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET), "-1"}},
             {{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG), CommonTestUtils::DEVICE_GPU},
                     {InferenceEngine::PluginConfigParams::KEY_PERFORMANCE_HINT, "DOESN'T EXIST"}},
             {{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG) , CommonTestUtils::DEVICE_GPU},
@@ -250,6 +252,8 @@ namespace {
             {{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG) , CommonTestUtils::DEVICE_GPU}},
             {{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG) , CommonTestUtils::DEVICE_GPU},
              {CONFIG_KEY(AUTO_BATCH_TIMEOUT) , "1"}},
+            {{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG) , CommonTestUtils::DEVICE_GPU},
+             {CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET) , "10"}},
     };
 
     INSTANTIATE_TEST_SUITE_P(smoke_BehaviorTests, DefaultValuesConfigTests,
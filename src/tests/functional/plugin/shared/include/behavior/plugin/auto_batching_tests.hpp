@@ -10,6 +10,7 @@
 #include <gpu/gpu_config.hpp>
 #include <common_test_utils/test_common.hpp>
 #include <functional_test_utils/plugin_cache.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 
 #include "ngraph_functions/subgraph_builders.hpp"
 #include "functional_test_utils/blob_utils.hpp"
@@ -158,6 +159,34 @@ public:
     }
 };
 
+using AutoBatchPartialParams = std::tuple<
+        std::string,  // device name
+        size_t,       // batch size
+        size_t>;      // number of the requests started, less than the batch size
+
+// Starts fewer requests than the batch size, so the timeout fires and the collected requests are executed
+// with the smaller batch sizes compiled for the AUTO_BATCH_LATENCY_TARGET
+class AutoBatching_Test_PartialBatch : public CommonTestUtils::TestsCommon,
+                                       public testing::WithParamInterface<AutoBatchPartialParams> {
+    void SetUp() override {
+        std::tie(device_name, num_batch, num_started) = this->GetParam();
+        fn_ptr = ngraph::builder::subgraph::makeSingleConv();
+    };
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<AutoBatchPartialParams> &obj) {
+        size_t batch, started;
+        std::string device_name;
+        std::tie(device_name, batch, started) = obj.param;
+        return device_name + "_batch_size_" + std::to_string(batch) + "_num_started_" + std::to_string(started);
+    }
+
+protected:
+    std::string device_name;
+    size_t num_batch;
+    size_t num_started;
+    std::shared_ptr<ngraph::Function> fn_ptr;
+};
+
 TEST_P(AutoBatching_Test, compareAutoBatchingToSingleBatch) {
     TestAutoBatch();
 }
@@ -166,4 +195,55 @@ TEST_P(AutoBatching_Test_DetectionOutput, compareAutoBatchingToSingleBatch) {
     TestAutoBatch();
 }
 
+TEST_P(AutoBatching_Test_PartialBatch, compareTimedOutBatchToSingleBatch) {
+    CNNNetwork net(fn_ptr);
+    auto inputs = net.getInputsInfo();
+    for (auto n : inputs) {
+        n.second->setPrecision(Precision::FP32);
+    }
+    auto output = net.getOutputsInfo().begin();
+
+    auto ie = InferenceEngine::Core();
+    std::map<std::string, std::string> config;
+    config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = std::to_string(10);
+    config[CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET)] = std::to_string(1000);
+    auto exec_net = ie.LoadNetwork(net, std::string(CommonTestUtils::DEVICE_BATCH) + ":" +
+                                        device_name + "(" + std::to_string(num_batch) + ")",
+                                   config);
+
+    // all the requests belong to the same batch, while only some of them are started
+    std::vector<InferRequest> irs;
+    std::vector<std::vector<uint8_t>> ref;
+    for (size_t j = 0; j < num_batch; j++) {
+        auto inf_req = exec_net.CreateInferRequest();
+        irs.push_back(inf_req);
+        std::vector<std::vector<uint8_t>> inData;
+        for (auto n : inputs) {
+            auto blob = FuncTestUtils::createAndFillBlob(n.second->getTensorDesc(), 10, 0, 1, static_cast<int>(j) + 1);
+            inf_req.SetBlob(n.first, blob);
+            const auto inBlobBuf = blob->cbuffer().as<uint8_t *>();
+            inData.push_back(std::vector<uint8_t>(inBlobBuf, inBlobBuf + blob->byteSize()));
+        }
+        ref.push_back(ngraph::helpers::interpreterFunction(fn_ptr, {inData}).front().second);
+    }
+
+    for (size_t j = 0; j < num_started; j++)
+        irs[j].StartAsync();
+    for (size_t j = 0; j < num_started; j++)
+        irs[j].Wait(InferRequest::RESULT_READY);
+
+    auto thr = FuncTestUtils::GetComparisonThreshold(InferenceEngine::Precision::FP32);
+    for (size_t j = 0; j < num_started; j++) {
+        auto outBlob = irs[j].GetBlob(output->first);
+        FuncTestUtils::compareRawBuffers(outBlob->buffer().as<float *>(),
+                                         reinterpret_cast<const float *>(ref[j].data()), outBlob->size(),
+                                         outBlob->size(), thr);
+    }
+
+    // a single request is executed with batch1, the rest are executed with the smaller batches
+    auto stats = exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_ADAPTIVE_TIMEOUT_STATISTICS))
+                         .as<std::map<std::string, uint64_t>>();
+    EXPECT_EQ(stats["PARTIAL_BATCHES"] > 0, num_started > 1);
+}
+
 }  // namespace AutoBatchingTests
\ No newline at end of file
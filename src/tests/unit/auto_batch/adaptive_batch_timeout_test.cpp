@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "auto_batch.hpp"
+
+using AutoBatchPlugin::AdaptiveBatchTimeout;
+using std::chrono::milliseconds;
+
+namespace {
+// the latency target of 10ms, so the batched execution is assumed to take 5ms until it is measured
+constexpr unsigned int latencyTarget = 10;
+constexpr int batchSize = 4;
+constexpr milliseconds idle{100};
+}  // namespace
+
+class AdaptiveBatchTimeoutTest : public ::testing::Test {
+protected:
+    AdaptiveBatchTimeout timeout{latencyTarget, batchSize};
+    const AdaptiveBatchTimeout::Clock::time_point start = AdaptiveBatchTimeout::Clock::now();
+};
+
+TEST_F(AdaptiveBatchTimeoutTest, ReturnsIdleTimeoutWhenNothingIsQueued) {
+    EXPECT_EQ(timeout.GetTimeout(idle, start), idle);
+
+    timeout.OnRequestArrived(start);
+    timeout.OnRequestsPopped(1);
+    EXPECT_EQ(timeout.GetTimeout(idle, start + milliseconds(1)), idle);
+}
+
+TEST_F(AdaptiveBatchTimeoutTest, CountsDownFromFirstQueuedRequest) {
+    timeout.OnRequestArrived(start);
+    EXPECT_EQ(timeout.GetTimeout(idle, start), milliseconds(5));
+    EXPECT_EQ(timeout.GetTimeout(idle, start + milliseconds(2)), milliseconds(3));
+    EXPECT_EQ(timeout.GetTimeout(idle, start + milliseconds(7)), milliseconds(0));
+    // the configured timeout is the upper bound
+    EXPECT_EQ(timeout.GetTimeout(milliseconds(1), start), milliseconds(1));
+}
+
+TEST_F(AdaptiveBatchTimeoutTest, MeasuredBatchExecutionShortensTimeout) {
+    timeout.OnBatchExecuted(milliseconds(8), batchSize, batchSize);
+    timeout.OnRequestArrived(start);
+    EXPECT_EQ(timeout.GetTimeout(idle, start), milliseconds(2));
+
+    // the partial batches don't affect the estimation of the full batch execution time
+    timeout.OnBatchExecuted(milliseconds(1), batchSize / 2, batchSize / 2);
+    EXPECT_EQ(timeout.GetTimeout(idle, start), milliseconds(2));
+}
+
+TEST_F(AdaptiveBatchTimeoutTest, DoesNotWaitForBatchThatCannotBeCollectedInTime) {
+    timeout.OnRequestArrived(start);
+    timeout.OnRequestArrived(start + milliseconds(5));
+    // the 2 missing requests are expected to arrive in 10ms, which is beyond the 5ms left to wait
+    EXPECT_EQ(timeout.GetTimeout(idle, start + milliseconds(5)), milliseconds(0));
+}
+
+TEST_F(AdaptiveBatchTimeoutTest, FollowsQueueAfterRequestsArePopped) {
+    timeout.OnRequestArrived(start);
+    timeout.OnRequestArrived(start + milliseconds(1));
+    timeout.OnRequestArrived(start + milliseconds(2));
+    timeout.OnRequestsPopped(2);
+    // the countdown is of the request that arrived at 2ms, not of the popped ones
+    EXPECT_EQ(timeout.GetTimeout(idle, start + milliseconds(3)), milliseconds(4));
+}
+
+TEST_F(AdaptiveBatchTimeoutTest, ReportsStatistics) {
+    timeout.OnRequestArrived(start);
+    timeout.OnRequestArrived(start + milliseconds(1));
+    timeout.OnBatchExecuted(milliseconds(4), batchSize, batchSize);
+    timeout.OnBatchExecuted(milliseconds(3), batchSize / 2, 2);
+    timeout.OnBatch1Executed(milliseconds(2), 2);
+    timeout.GetTimeout(idle, start + milliseconds(1));
+
+    const auto stats = timeout.GetStatistics();
+    EXPECT_EQ(stats.at("REQUESTS_INTERVAL"), 1000);
+    EXPECT_EQ(stats.at("BATCH_EXECUTION_TIME"), 4000);
+    EXPECT_EQ(stats.at("BATCH1_EXECUTION_TIME"), 1000);
+    EXPECT_EQ(stats.at("TIMEOUT"), 6000);
+    EXPECT_EQ(stats.at("PARTIAL_BATCHES"), 1);
+    EXPECT_EQ(stats.at("BATCH1_FALLBACKS"), 1);
+}
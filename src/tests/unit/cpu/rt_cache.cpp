@@ -3,12 +3,16 @@
 //
 
 #include <thread>
+#include <fstream>
+#include <cstdio>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/sharded_lru_cache.h"
+#include "cache/input_shapes_history.h"
 
 using namespace ov::intel_cpu;
 
@@ -379,3 +383,180 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(ShardedLruCacheTests, SingleShardKeepsLruPolicy) {
+    constexpr size_t capacity = 10;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 4; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+
+    for (int i = 21; i < 25; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < 4; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+    ASSERT_EQ(cache.getEvictionsCount(), 3);
+}
+
+TEST(ShardedLruCacheTests, Capacity) {
+    constexpr size_t capacity = 5000;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    ASSERT_EQ(cache.getCapacity(), capacity);
+    for (int i = 1; i < 2 * capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    size_t stored = 0;
+    for (int i = 1; i < 2 * capacity; ++i) {
+        if (cache.get({i}) == i) {
+            ++stored;
+        }
+    }
+    ASSERT_LE(stored, capacity + 16);
+    ASSERT_EQ(stored + cache.getEvictionsCount(), 2 * capacity - 1);
+}
+
+TEST(MultiCacheTests, Statistics) {
+    constexpr size_t capacity = 10;
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity);
+    for (int i = 0; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+    }
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+    }
+
+    auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.hits, capacity);
+    ASSERT_EQ(stats.misses, 2 * capacity);
+    ASSERT_EQ(stats.evictions, capacity);
+}
+
+TEST(MultiCacheTests, SmokeSharedBetweenThreads) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr size_t capacity = 5000;
+    constexpr size_t numKeys = 1000;
+    constexpr size_t numThreads = 8;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity);
+
+    auto testRoutine = [&]() {
+        for (int i = 0; i < numKeys; ++i) {
+            auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, i);
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.hits + stats.misses, numKeys * numThreads);
+    ASSERT_GE(stats.misses, numKeys);
+    ASSERT_EQ(stats.evictions, 0);
+
+    // all the keys are already cached, so any further lookup is a hit
+    for (int i = 0; i < numKeys; ++i) {
+        ASSERT_EQ(cache.getOrCreate(IntKey{i}, intBuilder).second, CacheEntryBase::LookUpStatus::Hit);
+    }
+}
+
+TEST(InputShapesHistoryTests, Persistence) {
+    const std::string filePath = "InputShapesHistoryTests_Persistence.cpu_shapes";
+    std::remove(filePath.c_str());
+
+    const std::vector<InputShapesHistory::Signature> signatures = {
+        {{1, 3, 224, 224}, {1, 10}},
+        {{2, 3, 112, 112}, {}},
+        {{4, 3, 56, 56}, {1}},
+    };
+    constexpr size_t capacity = 2;
+
+    {
+        InputShapesHistory history(filePath, capacity);
+        ASSERT_TRUE(history.getSignatures().empty());
+        for (const auto& signature : signatures) {
+            ASSERT_NO_THROW(history.record(signature));
+            ASSERT_NO_THROW(history.record(signature));
+        }
+        ASSERT_EQ(history.getSignatures().size(), capacity);
+        // the history is written to the file only on save or destruction
+        ASSERT_FALSE(std::ifstream(filePath).is_open());
+    }
+
+    InputShapesHistory history(filePath, capacity);
+    const auto restored = history.getSignatures();
+    std::remove(filePath.c_str());
+
+    ASSERT_EQ(restored.size(), capacity);
+    for (size_t i = 0; i < capacity; ++i) {
+        ASSERT_EQ(restored[i], signatures[i]);
+    }
+}
+
+TEST(InputShapesHistoryTests, Save) {
+    const std::string filePath = "InputShapesHistoryTests_Save.cpu_shapes";
+    std::remove(filePath.c_str());
+
+    const InputShapesHistory::Signature signature = {{1, 3, 224, 224}};
+    InputShapesHistory history(filePath, 10);
+    history.save();
+    ASSERT_FALSE(std::ifstream(filePath).is_open());
+
+    history.record(signature);
+    history.save();
+    const auto restored = InputShapesHistory(filePath, 10).getSignatures();
+    std::remove(filePath.c_str());
+
+    ASSERT_EQ(restored.size(), 1);
+    ASSERT_EQ(restored[0], signature);
+}
+
+TEST(InputShapesHistoryTests, SaveReplacesFile) {
+    const std::string filePath = "InputShapesHistoryTests_SaveReplacesFile.cpu_shapes";
+    std::remove(filePath.c_str());
+
+    const InputShapesHistory::Signature first = {{1, 3, 224, 224}};
+    const InputShapesHistory::Signature second = {{2, 3, 224, 224}};
+    InputShapesHistory history(filePath, 10);
+    history.record(first);
+    history.save();
+    history.record(second);
+    history.save();
+    const auto restored = InputShapesHistory(filePath, 10).getSignatures();
+    std::remove(filePath.c_str());
+
+    ASSERT_EQ(restored, std::vector<InputShapesHistory::Signature>({first, second}));
+    // the temporary file is renamed over the previous history
+    ASSERT_FALSE(std::ifstream(filePath + ".tmp").is_open());
+}
+
+TEST(InputShapesHistoryTests, CorruptedFile) {
+    const std::string filePath = "InputShapesHistoryTests_CorruptedFile.cpu_shapes";
+    {
+        std::ofstream file(filePath);
+        file << "some garbage\n[1,2,3]\n";
+    }
+
+    InputShapesHistory history(filePath, 10);
+    std::remove(filePath.c_str());
+    ASSERT_TRUE(history.getSignatures().empty());
+}
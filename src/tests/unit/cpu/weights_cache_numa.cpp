@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <numeric>
+
+#include <gtest/gtest.h>
+#include <ie_system_conf.h>
+
+#include "weights_cache.hpp"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+
+using namespace ov::intel_cpu;
+using WeightsNumaPolicy = Config::WeightsNumaPolicy;
+
+namespace {
+uint64_t totalBytes(const std::map<int, uint64_t>& bytesPerNode) {
+    return std::accumulate(bytesPerNode.begin(), bytesPerNode.end(), uint64_t{0},
+                           [](uint64_t sum, const std::pair<const int, uint64_t>& node) {
+                               return sum + node.second;
+                           });
+}
+}  // namespace
+
+TEST(NumaNodesWeightsTest, SingleCopyPoliciesShareCacheBetweenNodes) {
+    NumaNodesWeights weights;
+    const auto numaNodes = InferenceEngine::getAvailableNUMANodes();
+    ASSERT_FALSE(numaNodes.empty());
+
+    const auto interleaved = weights.get(numaNodes.front(), WeightsNumaPolicy::Interleave);
+    const auto firstTouch = weights.get(numaNodes.front(), WeightsNumaPolicy::FirstTouch);
+    EXPECT_NE(interleaved, firstTouch);
+    for (auto node : numaNodes) {
+        EXPECT_EQ(weights.get(node, WeightsNumaPolicy::Interleave), interleaved);
+        EXPECT_EQ(weights.get(node, WeightsNumaPolicy::FirstTouch), firstTouch);
+        // every node keeps its own copy of the weights
+        EXPECT_EQ(weights.get(node, WeightsNumaPolicy::Replicate), weights[node]);
+        EXPECT_NE(weights[node], interleaved);
+        EXPECT_NE(weights[node], firstTouch);
+    }
+}
+
+TEST(NumaNodesWeightsTest, BytesPerNodeCountCachedWeightsOfPolicy) {
+    const mkldnn::engine cpuEngine(dnnl::engine::kind::cpu, 0);
+    const CpuBlockedMemoryDesc desc(InferenceEngine::Precision::FP32, Shape(VectorDims{256, 1024}));
+    const auto numaNode = InferenceEngine::getAvailableNUMANodes().front();
+
+    for (auto policy : {WeightsNumaPolicy::Replicate, WeightsNumaPolicy::Interleave, WeightsNumaPolicy::FirstTouch}) {
+        NumaNodesWeights weights;
+        MKLDNNMemoryPtr cached = *weights.get(numaNode, policy)->findOrCreate("weights", [&] {
+            auto memory = std::make_shared<MKLDNNMemory>(cpuEngine);
+            memory->Create(desc);
+            // populates the pages, so their placement is known
+            std::memset(memory->GetData(), 1, memory->GetSize());
+            return memory;
+        });
+        EXPECT_EQ(totalBytes(weights.getBytesPerNode(policy)), cached->GetSize());
+
+        // the caches of the other policies are not accounted
+        for (auto other : {WeightsNumaPolicy::Interleave, WeightsNumaPolicy::FirstTouch}) {
+            if (other != policy)
+                EXPECT_EQ(totalBytes(weights.getBytesPerNode(other)), uint64_t{0});
+        }
+
+        // the weights are not accounted once the networks release them
+        cached.reset();
+        EXPECT_EQ(totalBytes(weights.getBytesPerNode(policy)), uint64_t{0});
+    }
+}